@@ -0,0 +1,338 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <new> //  std::bad_alloc
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/// -    Google Benchmark:    
+///  ,     ,  
+///     (,  ,  ).
+
+///   .   operator new
+///   ,  MEGABENCH_COUNT_ALLOCATIONS
+inline std::atomic<std::uint64_t>& benchAllocations() {
+    static std::atomic<std::uint64_t> count(0);
+    return count;
+}
+
+///   operator new / delete   .
+///       
+#define MEGABENCH_COUNT_ALLOCATIONS                                                 \
+    void* operator new(std::size_t size) {                                          \
+        benchAllocations().fetch_add(1, std::memory_order_relaxed);                 \
+        if (void* p = std::malloc(size == 0 ? 1 : size)) {                          \
+            return p;                                                               \
+        }                                                                           \
+        throw std::bad_alloc();                                                     \
+    }                                                                               \
+    void* operator new[](std::size_t size) { return operator new(size); }          \
+    void operator delete(void* p) noexcept { std::free(p); }                        \
+    void operator delete[](void* p) noexcept { std::free(p); }                      \
+    void operator delete(void* p, std::size_t) noexcept { std::free(p); }           \
+    void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+///     .  Linux  perf_event_open,
+///    (    perf)  
+class CacheMissCounter {
+public:
+    CacheMissCounter() {
+#ifdef __linux__
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd = static_cast<int>(::syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+    }
+
+    ~CacheMissCounter() {
+#ifdef __linux__
+        if (fd >= 0) {
+            ::close(fd);
+        }
+#endif
+    }
+
+    CacheMissCounter(const CacheMissCounter&) = delete;
+    CacheMissCounter& operator=(const CacheMissCounter&) = delete;
+
+    bool available() const {
+        return fd >= 0;
+    }
+
+    ///    (0,  )
+    std::uint64_t read() const {
+        std::uint64_t value = 0;
+#ifdef __linux__
+        if (fd >= 0 && ::read(fd, &value, sizeof(value)) != static_cast<ssize_t>(sizeof(value))) {
+            value = 0;
+        }
+#endif
+        return value;
+    }
+
+private:
+    int fd = -1;
+};
+
+///  :     .  
+///     pauseTiming / resumeTiming    
+///   ,      
+class BenchState {
+public:
+    BenchState(size_t size, size_t iterations, const CacheMissCounter& misses)
+        : size(size), remaining(iterations), iterations(iterations), misses(misses) {}
+
+    ///   ( )
+    size_t range() const {
+        return size;
+    }
+
+    ///  : while (state.keepRunning()) { ... }
+    bool keepRunning() {
+        if (!started) {
+            started = true;
+            resumeTiming();
+        }
+        if (remaining == 0) {
+            pauseTiming();
+            return false;
+        }
+        --remaining;
+        return true;
+    }
+
+    void pauseTiming() {
+        if (!running) {
+            return;
+        }
+        elapsed += std::chrono::steady_clock::now() - startTime;
+        allocations += benchAllocations().load(std::memory_order_relaxed) - startAllocations;
+        cacheMisses += misses.read() - startMisses;
+        running = false;
+    }
+
+    void resumeTiming() {
+        if (running) {
+            return;
+        }
+        running = true;
+        startAllocations = benchAllocations().load(std::memory_order_relaxed);
+        startMisses = misses.read();
+        startTime = std::chrono::steady_clock::now();
+    }
+
+    ///      (    )
+    void setOpsPerIteration(size_t ops) {
+        opsPerIteration = ops;
+    }
+
+    size_t iterationCount() const { return iterations; }
+    size_t totalOps() const { return iterations * opsPerIteration; }
+    double seconds() const { return std::chrono::duration<double>(elapsed).count(); }
+    std::uint64_t allocationCount() const { return allocations; }
+    std::uint64_t cacheMissCount() const { return cacheMisses; }
+
+private:
+    size_t size;
+    size_t remaining;
+    size_t iterations;
+    size_t opsPerIteration = 0;
+    const CacheMissCounter& misses;
+    bool started = false;
+    bool running = false;
+    std::chrono::steady_clock::time_point startTime;
+    std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::duration::zero();
+    std::uint64_t startAllocations = 0;
+    std::uint64_t allocations = 0;
+    std::uint64_t startMisses = 0;
+    std::uint64_t cacheMisses = 0;
+};
+
+///       
+struct BenchResult {
+    std::string name;
+    size_t size;
+    size_t iterations;
+    double nsPerOp;
+    double allocsPerOp;
+    double cacheMissesPerOp; // < 0   
+};
+
+///    
+class BenchRunner {
+public:
+    using Function = std::function<void(BenchState&)>;
+
+    ///  . maxSize    ,
+    ///       ( )
+    void add(const std::string& name, Function function, size_t maxSize = 10000000) {
+        benchmarks.push_back(Benchmark{ name, function, maxSize });
+    }
+
+    ///    :
+    /// --filter=<> --min-size=N --max-size=N --min-time=<> --json=<>
+    void parseArguments(int argc, char** argv) {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            if (startsWith(arg, "--filter=")) {
+                filter = arg.substr(9);
+            }
+            else if (startsWith(arg, "--min-size=")) {
+                minSize = std::max<size_t>(1, static_cast<size_t>(std::atof(arg.c_str() + 11)));
+            }
+            else if (startsWith(arg, "--max-size=")) {
+                maxSize = static_cast<size_t>(std::atof(arg.c_str() + 11));
+            }
+            else if (startsWith(arg, "--min-time=")) {
+                minTime = std::atof(arg.c_str() + 11);
+            }
+            else if (startsWith(arg, "--json=")) {
+                jsonPath = arg.substr(7);
+            }
+            else {
+                std::cerr << "Unknown argument: " << arg << "\n"
+                    << "Usage: MegaBench [--filter=<substring>] [--min-size=N] [--max-size=N] [--min-time=<seconds>] [--json=<file>]\n";
+                std::exit(1);
+            }
+        }
+    }
+
+    ///       minSize, 10 * minSize, ... maxSize
+    int run() {
+        std::vector<BenchResult> results;
+        std::cout << std::left << std::setw(36) << "Benchmark" << std::right
+            << std::setw(14) << "Iterations" << std::setw(14) << "ns/op"
+            << std::setw(14) << "allocs/op" << std::setw(16) << "misses/op" << "\n";
+        for (const Benchmark& benchmark : benchmarks) {
+            if (!filter.empty() && benchmark.name.find(filter) == std::string::npos) {
+                continue;
+            }
+            for (size_t size = minSize; size <= maxSize && size <= benchmark.maxSize; size *= 10) {
+                BenchResult result = measure(benchmark, size);
+                print(result);
+                results.push_back(result);
+            }
+        }
+        if (!jsonPath.empty()) {
+            std::ofstream out(jsonPath);
+            if (!out) {
+                std::cerr << "Cannot write " << jsonPath << "\n";
+                return 1;
+            }
+            writeJson(out, results);
+        }
+        return 0;
+    }
+
+private:
+    struct Benchmark {
+        std::string name;
+        Function function;
+        size_t maxSize;
+    };
+
+    std::vector<Benchmark> benchmarks;
+    CacheMissCounter misses;
+    std::string filter;
+    std::string jsonPath;
+    size_t minSize = 100;
+    size_t maxSize = 10000000;
+    double minTime = 0.2;
+
+    static bool startsWith(const std::string& text, const char* prefix) {
+        return text.compare(0, std::strlen(prefix), prefix) == 0;
+    }
+
+    ///   ,     minTime (  Google Benchmark)
+    BenchResult measure(const Benchmark& benchmark, size_t size) {
+        size_t iterations = 1;
+        while (true) {
+            BenchState state(size, iterations, misses);
+            state.setOpsPerIteration(size);
+            benchmark.function(state);
+            double seconds = state.seconds();
+            if (seconds >= minTime || iterations >= 1000000000) {
+                double ops = static_cast<double>(state.totalOps() == 0 ? iterations : state.totalOps());
+                BenchResult result;
+                result.name = benchmark.name + "/" + std::to_string(size);
+                result.size = size;
+                result.iterations = iterations;
+                result.nsPerOp = seconds * 1e9 / ops;
+                result.allocsPerOp = static_cast<double>(state.allocationCount()) / ops;
+                result.cacheMissesPerOp = misses.available() ? static_cast<double>(state.cacheMissCount()) / ops : -1.0;
+                return result;
+            }
+            double scale = seconds <= 0.0 ? 10.0 : std::min(10.0, 1.4 * minTime / seconds);
+            iterations = std::max(iterations + 1, static_cast<size_t>(static_cast<double>(iterations) * scale));
+        }
+    }
+
+    static void print(const BenchResult& result) {
+        std::cout << std::left << std::setw(36) << result.name << std::right
+            << std::setw(14) << result.iterations
+            << std::setw(14) << std::fixed << std::setprecision(2) << result.nsPerOp
+            << std::setw(14) << std::setprecision(4) << result.allocsPerOp;
+        if (result.cacheMissesPerOp < 0) {
+            std::cout << std::setw(16) << "n/a";
+        }
+        else {
+            std::cout << std::setw(16) << std::setprecision(4) << result.cacheMissesPerOp;
+        }
+        std::cout << "\n";
+    }
+
+    ///    --benchmark_format=json:     
+    void writeJson(std::ostream& out, const std::vector<BenchResult>& results) const {
+        std::time_t now = std::time(nullptr);
+        char date[32];
+        std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+        out << "{\n  \"context\": {\n"
+            << "    \"date\": \"" << date << "\",\n"
+            << "    \"min_time\": " << minTime << ",\n"
+            << "    \"cache_misses_available\": " << (misses.available() ? "true" : "false") << "\n"
+            << "  },\n  \"benchmarks\": [\n";
+        for (size_t i = 0; i < results.size(); ++i) {
+            const BenchResult& result = results[i];
+            out << "    {\n"
+                << "      \"name\": \"" << result.name << "\",\n"
+                << "      \"size\": " << result.size << ",\n"
+                << "      \"iterations\": " << result.iterations << ",\n"
+                << "      \"time_unit\": \"ns\",\n"
+                << "      \"ns_per_op\": " << std::setprecision(6) << result.nsPerOp << ",\n"
+                << "      \"allocs_per_op\": " << result.allocsPerOp << ",\n"
+                << "      \"cache_misses_per_op\": ";
+            if (result.cacheMissesPerOp < 0) {
+                out << "null";
+            }
+            else {
+                out << result.cacheMissesPerOp;
+            }
+            out << "\n    }" << (i + 1 < results.size() ? "," : "") << "\n";
+        }
+        out << "  ]\n}\n";
+    }
+};
@@ -0,0 +1,463 @@
+#include <algorithm>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Bench.h"
+#include "../MegaHeap/MegaHeap.h"
+#include "../MegaStructure-master/Chain2.h"
+#include "../MegaStructure-master/HeavyIronWell.h"
+#include "../MegaStructure-master/QSnake.h"
+#include "../MegaStructure-master/Ladder3One.h"
+#include "../MegaStructure-master/UnrolledChain.h"
+
+MEGABENCH_COUNT_ALLOCATIONS
+
+volatile char benchSink;
+
+///      
+template <typename T>
+void keep(const T& value) {
+    benchSink = *reinterpret_cast<const volatile char*>(&value);
+}
+
+///   
+std::vector<int> randomValues(size_t count, unsigned seed = 42) {
+    std::mt19937 rng(seed);
+    std::vector<int> values(count);
+    for (int& value : values) {
+        value = static_cast<int>(rng() % 1000000000);
+    }
+    return values;
+}
+
+///    values
+void fillChain(Chain2<int>& chain, const std::vector<int>& values) {
+    for (int value : values) {
+        chain.adder.back(value);
+    }
+}
+
+// ---------- Heap ----------
+
+void benchHeapPush(BenchState& state) {
+    std::vector<int> values = randomValues(state.range());
+    while (state.keepRunning()) {
+        Heap<int> heap;
+        for (int value : values) {
+            heap.push(value);
+        }
+        keep(heap.top());
+    }
+}
+
+void benchHeapPop(BenchState& state) {
+    std::vector<int> values = randomValues(state.range());
+    while (state.keepRunning()) {
+        state.pauseTiming();
+        Heap<int> heap(values);
+        state.resumeTiming();
+        while (!heap.empty()) {
+            heap.pop();
+        }
+    }
+}
+
+void benchHeapBuild(BenchState& state) {
+    std::vector<int> values = randomValues(state.range());
+    while (state.keepRunning()) {
+        Heap<int> heap(values);
+        keep(heap.top());
+    }
+}
+
+void benchHeapSort(BenchState& state) {
+    std::vector<int> values = randomValues(state.range());
+    std::vector<int> buffer;
+    while (state.keepRunning()) {
+        state.pauseTiming();
+        buffer = values;
+        state.resumeTiming();
+        Heap<int>::sortInPlace(buffer, SortOrder::Ascending);
+        keep(buffer.front());
+    }
+}
+
+// ---------- Chain2 ----------
+
+void benchChainPushBack(BenchState& state) {
+    std::vector<int> values = randomValues(state.range());
+    while (state.keepRunning()) {
+        Chain2<int> chain;
+        fillChain(chain, values);
+        keep(chain.getSize());
+    }
+}
+
+//   :     
+void benchChainPushBackPool(BenchState& state) {
+    std::vector<int> values = randomValues(state.range());
+    while (state.keepRunning()) {
+        Chain2<int, PoolLinkAllocator<int>> chain;
+        for (int value : values) {
+            chain.adder.back(value);
+        }
+        keep(chain.getSize());
+    }
+}
+
+//   :      
+void benchChainFromRange(BenchState& state) {
+    std::vector<int> values = randomValues(state.range());
+    while (state.keepRunning()) {
+        Chain2<int> chain(values.begin(), values.end());
+        keep(chain.getSize());
+    }
+}
+
+//    :     
+void benchChainFromRangePool(BenchState& state) {
+    std::vector<int> values = randomValues(state.range());
+    while (state.keepRunning()) {
+        Chain2<int, PoolLinkAllocator<int>> chain(values.begin(), values.end());
+        keep(chain.getSize());
+    }
+}
+
+void benchChainCopyPool(BenchState& state) {
+    std::vector<int> values = randomValues(state.range());
+    Chain2<int, PoolLinkAllocator<int>> source(values.begin(), values.end());
+    while (state.keepRunning()) {
+        state.pauseTiming();
+        Chain2<int, PoolLinkAllocator<int>> copy(PoolLinkAllocator<int>{});
+        state.resumeTiming();
+        copy = source;
+        keep(copy.getLast()->getData());
+    }
+}
+
+void benchChainPushFront(BenchState& state) {
+    std::vector<int> values = randomValues(state.range());
+    while (state.keepRunning()) {
+        Chain2<int> chain;
+        for (int value : values) {
+            chain.adder.front(value);
+        }
+        keep(chain.getSize());
+    }
+}
+
+//       O(log n);  seek  
+void benchChainSeek(BenchState& state) {
+    std::vector<int> values = randomValues(state.range());
+    std::vector<int> positions = randomValues(state.range(), 7);
+    Chain2<int> chain;
+    fillChain(chain, values);
+    while (state.keepRunning()) {
+        for (int position : positions) {
+            chain.seek(static_cast<size_t>(position) % chain.getSize());
+        }
+        keep(chain.getCurrent()->getData());
+    }
+}
+
+//     :     
+void benchChainClusteredEdits(BenchState& state) {
+    std::vector<int> values = randomValues(state.range());
+    while (state.keepRunning()) {
+        state.pauseTiming();
+        Chain2<int> chain;
+        chain.setFingerCache(4);
+        fillChain(chain, values);
+        size_t spot[3] = { chain.getSize() / 4, chain.getSize() / 2, chain.getSize() * 3 / 4 };
+        state.resumeTiming();
+        for (size_t i = 0; i < values.size(); ++i) {
+            size_t& position = spot[i % 3];
+            position = (position + static_cast<size_t>(values[i]) % 5 + chain.getSize() - 2) % chain.getSize();
+            chain.adder.at(position, values[i]);
+            chain.deleter.at(position + 1);
+        }
+        keep(chain.getSize());
+        state.pauseTiming();
+        chain.clear();
+        state.resumeTiming();
+    }
+}
+
+//      
+void benchChainInsertAt(BenchState& state) {
+    std::vector<int> values = randomValues(state.range());
+    while (state.keepRunning()) {
+        Chain2<int> chain(0);
+        for (int value : values) {
+            chain.adder.at(static_cast<size_t>(value) % chain.getSize(), value);
+        }
+        keep(chain.getSize());
+    }
+}
+
+void benchChainEraseFront(BenchState& state) {
+    std::vector<int> values = randomValues(state.range());
+    while (state.keepRunning()) {
+        state.pauseTiming();
+        Chain2<int> chain;
+        fillChain(chain, values);
+        state.resumeTiming();
+        while (!chain.isEmpty()) {
+            chain.deleter.front();
+        }
+    }
+}
+
+void benchChainEraseBack(BenchState& state) {
+    std::vector<int> values = randomValues(state.range());
+    while (state.keepRunning()) {
+        state.pauseTiming();
+        Chain2<int> chain;
+        fillChain(chain, values);
+        state.resumeTiming();
+        while (!chain.isEmpty()) {
+            chain.deleter.back();
+        }
+    }
+}
+
+//       :       
+void benchChainDivide(BenchState& state) {
+    Chain2<int> chain;
+    fillChain(chain, randomValues(state.range()));
+    Chain2<int> tail;
+    size_t index = state.range() - state.range() / 4;
+    state.setOpsPerIteration(1);
+    while (state.keepRunning()) {
+        chain.divide(index, tail);
+        chain.concatenate(tail);
+    }
+    keep(chain.getLast()->getData());
+}
+
+//      
+void benchChainSort(BenchState& state) {
+    std::vector<int> values = randomValues(state.range());
+    while (state.keepRunning()) {
+        state.pauseTiming();
+        Chain2<int> chain;
+        fillChain(chain, values);
+        state.resumeTiming();
+        chain.sort();
+        keep(chain.getFirst()->getData());
+        state.pauseTiming();
+        chain.clear(); //      
+        state.resumeTiming();
+    }
+}
+
+void benchChainRadixSort(BenchState& state) {
+    std::vector<int> values = randomValues(state.range());
+    while (state.keepRunning()) {
+        state.pauseTiming();
+        Chain2<int> chain;
+        fillChain(chain, values);
+        state.resumeTiming();
+        chain.radixSort();
+        keep(chain.getFirst()->getData());
+        state.pauseTiming();
+        chain.clear();
+        state.resumeTiming();
+    }
+}
+
+//  double  :     
+void benchChainRadixSortDouble(BenchState& state) {
+    std::vector<int> values = randomValues(state.range());
+    while (state.keepRunning()) {
+        state.pauseTiming();
+        Chain2<double> chain;
+        for (int value : values) {
+            chain.adder.back((value - 500000000) / 1024.0);
+        }
+        state.resumeTiming();
+        chain.radixSort();
+        keep(chain.getFirst()->getData());
+        state.pauseTiming();
+        chain.clear();
+        state.resumeTiming();
+    }
+}
+
+//    threads  (     )
+void benchChainParallelSort(BenchState& state, size_t threads) {
+    std::vector<int> values = randomValues(state.range());
+    while (state.keepRunning()) {
+        state.pauseTiming();
+        Chain2<int> chain;
+        fillChain(chain, values);
+        state.resumeTiming();
+        chain.parallelSort(threads, 16384);
+        keep(chain.getFirst()->getData());
+        state.pauseTiming();
+        chain.clear();
+        state.resumeTiming();
+    }
+}
+
+//  :      
+void benchChainTraverse(BenchState& state) {
+    Chain2<int> chain;
+    fillChain(chain, randomValues(state.range()));
+    while (state.keepRunning()) {
+        long long sum = 0;
+        for (int value : chain) {
+            sum += value;
+        }
+        keep(sum);
+    }
+}
+
+// ---------- UnrolledChain ----------
+
+void benchUnrolledPushBack(BenchState& state) {
+    std::vector<int> values = randomValues(state.range());
+    while (state.keepRunning()) {
+        UnrolledChain<int> chain;
+        for (int value : values) {
+            chain.adder.back(value);
+        }
+        keep(chain.getSize());
+    }
+}
+
+//  :      
+void benchUnrolledTraverse(BenchState& state) {
+    UnrolledChain<int> chain;
+    for (int value : randomValues(state.range())) {
+        chain.adder.back(value);
+    }
+    while (state.keepRunning()) {
+        long long sum = 0;
+        for (int value : chain) {
+            sum += value;
+        }
+        keep(sum);
+    }
+}
+
+void benchUnrolledSort(BenchState& state) {
+    std::vector<int> values = randomValues(state.range());
+    while (state.keepRunning()) {
+        state.pauseTiming();
+        UnrolledChain<int> chain;
+        for (int value : values) {
+            chain.adder.back(value);
+        }
+        state.resumeTiming();
+        chain.sort();
+        keep(chain.front());
+        state.pauseTiming();
+        chain.clear();
+        state.resumeTiming();
+    }
+}
+
+// ---------- HIWell, QSnake ----------
+
+void benchWellPushPull(BenchState& state) {
+    std::vector<int> values = randomValues(state.range());
+    state.setOpsPerIteration(2 * state.range()); // push  pull  
+    while (state.keepRunning()) {
+        HIWell<int> well;
+        for (int value : values) {
+            well.push(value);
+        }
+        long long sum = 0;
+        while (!well.isEmpty()) {
+            sum += well.pull();
+        }
+        keep(sum);
+    }
+}
+
+void benchSnakePushPull(BenchState& state) {
+    std::vector<int> values = randomValues(state.range());
+    state.setOpsPerIteration(2 * state.range());
+    while (state.keepRunning()) {
+        QSnake<int> snake;
+        for (int value : values) {
+            snake.push(value);
+        }
+        long long sum = 0;
+        while (snake.getSize() != 0) {
+            sum += snake.pull();
+        }
+        keep(sum);
+    }
+}
+
+// ---------- Ladder3 ----------
+
+///  "1 2 + 3 - 4 + ..."  count 
+std::string postfixExpression(size_t count) {
+    std::mt19937 rng(7);
+    std::string expression = "1";
+    for (size_t i = 1; i < count; ++i) {
+        expression += ' ';
+        expression += std::to_string(1 + rng() % 100);
+        expression += ' ';
+        expression += "+-*"[i % 3];
+    }
+    return expression;
+}
+
+//      
+void benchPostfix(BenchState& state) {
+    std::string expression = postfixExpression(state.range());
+    state.setOpsPerIteration(2 * state.range() - 1);
+    Ladder3 calculator;
+    while (state.keepRunning()) {
+        calculator.setExpression(expression);
+        keep(calculator.postfix().calculate());
+    }
+}
+
+int main(int argc, char** argv) {
+    BenchRunner runner;
+    runner.add("Heap/push", benchHeapPush);
+    runner.add("Heap/pop", benchHeapPop);
+    runner.add("Heap/build", benchHeapBuild);
+    runner.add("Heap/sortInPlace", benchHeapSort);
+    runner.add("Chain2/pushBack", benchChainPushBack);
+    runner.add("Chain2/pushBackPool", benchChainPushBackPool);
+    runner.add("Chain2/fromRange", benchChainFromRange);
+    runner.add("Chain2/fromRangePool", benchChainFromRangePool);
+    runner.add("Chain2/copyPool", benchChainCopyPool);
+    runner.add("Chain2/pushFront", benchChainPushFront);
+    runner.add("Chain2/seek", benchChainSeek);
+    runner.add("Chain2/insertAt", benchChainInsertAt);
+    runner.add("Chain2/clusteredEdits", benchChainClusteredEdits);
+    runner.add("Chain2/eraseFront", benchChainEraseFront);
+    runner.add("Chain2/eraseBack", benchChainEraseBack);
+    runner.add("Chain2/divide", benchChainDivide);
+    runner.add("Chain2/sort", benchChainSort);
+    runner.add("Chain2/radixSort", benchChainRadixSort);
+    runner.add("Chain2/radixSortDouble", benchChainRadixSortDouble);
+    //   : 1, 2, 4, ...    
+    size_t cores = std::max<size_t>(1, std::thread::hardware_concurrency());
+    std::vector<size_t> threadCounts;
+    for (size_t threads = 1; threads < cores; threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(cores);
+    for (size_t threads : threadCounts) {
+        runner.add("Chain2/parallelSort/threads:" + std::to_string(threads),
+            [threads](BenchState& state) { benchChainParallelSort(state, threads); });
+    }
+    runner.add("Chain2/traverse", benchChainTraverse);
+    runner.add("Unrolled/pushBack", benchUnrolledPushBack);
+    runner.add("Unrolled/traverse", benchUnrolledTraverse);
+    runner.add("Unrolled/sort", benchUnrolledSort);
+    runner.add("HIWell/pushPull", benchWellPushPull);
+    runner.add("QSnake/pushPull", benchSnakePushPull);
+    runner.add("Ladder3/postfix", benchPostfix);
+    runner.parseArguments(argc, argv);
+    return runner.run();
+}
@@ -0,0 +1,210 @@
+#pragma once
+#include <atomic>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+#include <memory>
+#include <new> //  placement new
+#include "MegaHeap.h"
+
+///   ConcurrentHeap
+enum class ConcurrencyMode {
+    Relaxed, // MultiQueue:     ,   
+    Strict   //      
+};
+
+///       Heap.
+///     ,    ,
+///        .
+/// Relaxed: pop          
+/// (MultiQueue,   )       .
+/// Strict: pop         
+///     (   ),    
+/// ,         ,    .
+///   ,  :  ,   
+///  ,      
+template <typename T, typename Compare = std::less<T>, size_t Arity = 2>
+class ConcurrentHeap {
+public:
+    /// queueCount   ;      
+    explicit ConcurrentHeap(ConcurrencyMode mode = ConcurrencyMode::Relaxed, size_t queueCount = 0, const Compare& compare = Compare())
+        : mode(mode), comp(compare), count(0) {
+        if (queueCount == 0) {
+            size_t cores = std::thread::hardware_concurrency();
+            queueCount = 2 * (cores == 0 ? 1 : cores);
+        }
+        shards = ShardAllocator().allocate(queueCount);
+        try {
+            for (; shardCount < queueCount; ++shardCount) {
+                new (shards + shardCount) Shard(compare);
+            }
+        }
+        catch (...) {
+            destroyShards();
+            throw;
+        }
+    }
+
+    ConcurrentHeap(const ConcurrentHeap&) = delete;
+    ConcurrentHeap& operator=(const ConcurrentHeap&) = delete;
+
+    ~ConcurrentHeap() {
+        destroyShards();
+    }
+
+    ///     .  pushAttempts  
+    ///        
+    void push(T value) {
+        for (size_t attempt = 0;; ++attempt) {
+            Shard& shard = shards[randomIndex()];
+            std::unique_lock<std::mutex> lock(shard.lock, std::defer_lock);
+            if (attempt < pushAttempts * shardCount) {
+                if (!lock.try_lock()) {
+                    continue;
+                }
+            }
+            else {
+                lock.lock();
+            }
+            if (shard.heap.empty() || comp(shard.heap.top(), value)) {
+                shard.version.fetch_add(1); //      
+            }
+            shard.heap.push(std::move(value));
+            count.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    ///    out.  false,   
+    bool tryPop(T& out) {
+        if (mode == ConcurrencyMode::Strict || shardCount == 1) {
+            return popStrict(out);
+        }
+
+        //    ,     
+        for (size_t attempt = 0; attempt < 2 * shardCount; ++attempt) {
+            size_t first = randomIndex();
+            size_t second = randomIndex();
+            if (first == second) {
+                continue;
+            }
+            std::unique_lock<std::mutex> firstLock(shards[first].lock, std::try_to_lock);
+            if (!firstLock.owns_lock()) {
+                continue;
+            }
+            std::unique_lock<std::mutex> secondLock(shards[second].lock, std::try_to_lock);
+            if (!secondLock.owns_lock()) {
+                continue;
+            }
+
+            Shard& a = shards[first];
+            Shard& b = shards[second];
+            if (a.heap.empty() && b.heap.empty()) {
+                continue;
+            }
+            Shard& best = b.heap.empty() || (!a.heap.empty() && !comp(a.heap.top(), b.heap.top())) ? a : b;
+            popFrom(best, out);
+            return true;
+        }
+        return popStrict(out);
+    }
+
+    ///   (,    )
+    size_t size() const {
+        return count.load(std::memory_order_relaxed);
+    }
+
+    ///    (,   )
+    bool empty() const {
+        return size() == 0;
+    }
+
+    ///  
+    size_t queueCount() const {
+        return shardCount;
+    }
+
+private:
+    /// :        .
+    ///   -,        
+    struct alignas(64) Shard {
+        explicit Shard(const Compare& compare) : heap(compare), version(0) {}
+
+        std::mutex lock;
+        Heap<T, Compare, Arity> heap;
+        std::atomic<size_t> version; //     
+    };
+
+    ///  : CacheAlignedAllocator   1  -,
+    ///   Shard  64,    
+    /// (new  C++14   alignas  alignof(std::max_align_t))
+    using ShardAllocator = CacheAlignedAllocator<Shard>;
+
+    ///   try_lock  ,   push  
+    enum : size_t { pushAttempts = 2 };
+
+    ConcurrencyMode mode;
+    Compare comp;
+    Shard* shards = nullptr;
+    size_t shardCount = 0;
+    std::atomic<size_t> count;
+
+    ///  ,     
+    size_t randomIndex() const {
+        thread_local std::minstd_rand rng(static_cast<unsigned>(std::hash<std::thread::id>()(std::this_thread::get_id())));
+        return rng() % shardCount;
+    }
+
+    void destroyShards() {
+        for (size_t i = shardCount; i-- > 0;) {
+            shards[i].~Shard();
+        }
+        ShardAllocator().deallocate(shards, shardCount);
+        shards = nullptr;
+        shardCount = 0;
+    }
+
+    ///    
+    void popFrom(Shard& shard, T& out) {
+        shard.version.fetch_add(1); //      
+        shard.heap.popN(1, &out);
+        count.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    ///  .     ,  
+    /// ,        
+    ///  ,    .   
+    ///    (  )     : 
+    ///  ,    ,      
+    ///          
+    bool popStrict(T& out) {
+        while (true) {
+            std::unique_lock<std::mutex> bestLock;
+            Shard* best = nullptr;
+            size_t seen = 0;
+            for (size_t i = 0; i < shardCount; ++i) {
+                Shard& shard = shards[i];
+                std::unique_lock<std::mutex> lock(shard.lock);
+                seen += shard.version.load();
+                if (!shard.heap.empty() && (best == nullptr || comp(best->heap.top(), shard.heap.top()))) {
+                    best = &shard;
+                    bestLock = std::move(lock);
+                }
+            }
+
+            size_t current = 0;
+            for (size_t i = 0; i < shardCount; ++i) {
+                current += shards[i].version.load();
+            }
+            if (current != seen) {
+                continue; //  -     
+            }
+            if (best == nullptr) {
+                return false;
+            }
+            popFrom(*best, out);
+            return true;
+        }
+    }
+};
@@ -0,0 +1,189 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring> //  std::memcpy
+#include <functional> //  std::hash, std::equal_to
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+///    Heap::find:    .
+/// Heap     ,    
+///   ,    
+template <typename T>
+class MembershipIndex {
+public:
+    virtual ~MembershipIndex() {}
+
+    ///     
+    virtual void add(const T& value) = 0;
+
+    ///    
+    virtual void remove(const T& value) = 0;
+
+    ///  
+    virtual size_t count(const T& value) const = 0;
+
+    ///  
+    virtual void clear() = 0;
+
+    ///      
+    virtual size_t memoryUsage() const = 0;
+
+    ///   (  )
+    virtual MembershipIndex* clone() const = 0;
+};
+
+///   std::unordered_map      
+template <typename T, typename Hash = std::hash<T>, typename Equal = std::equal_to<T>>
+class HashMembershipIndex : public MembershipIndex<T> {
+public:
+    void add(const T& value) override {
+        ++counts[value];
+    }
+
+    void remove(const T& value) override {
+        auto it = counts.find(value);
+        if (it != counts.end() && --it->second == 0) {
+            counts.erase(it);
+        }
+    }
+
+    size_t count(const T& value) const override {
+        auto it = counts.find(value);
+        return it == counts.end() ? 0 : it->second;
+    }
+
+    void clear() override {
+        counts.clear();
+    }
+
+    ///      (, , , )  
+    size_t memoryUsage() const override {
+        return sizeof(*this) + counts.bucket_count() * sizeof(void*)
+            + counts.size() * (sizeof(std::pair<const T, size_t>) + sizeof(void*) + sizeof(size_t));
+    }
+
+    MembershipIndex<T>* clone() const override {
+        return new HashMembershipIndex(*this);
+    }
+
+private:
+    std::unordered_map<T, size_t, Hash, Equal> counts;
+};
+
+///        .
+///          (    0),
+///    ,    ,
+///   .    1/2.
+/// -0.0  +0.0   ; NaN   (    )
+template <typename T>
+class FlatMembershipIndex : public MembershipIndex<T> {
+    static_assert(std::is_arithmetic<T>::value, "FlatMembershipIndex requires an arithmetic key.");
+
+public:
+    FlatMembershipIndex() : slots(16), used(0) {}
+
+    void add(const T& value) override {
+        if (2 * (used + 1) > slots.size()) {
+            grow();
+        }
+        T key = normalize(value);
+        size_t i = find(key);
+        if (slots[i].count == 0) {
+            slots[i].key = key;
+            ++used;
+        }
+        ++slots[i].count;
+    }
+
+    void remove(const T& value) override {
+        size_t i = find(normalize(value));
+        if (slots[i].count == 0 || --slots[i].count != 0) {
+            return;
+        }
+        --used;
+
+        //  :       
+        size_t mask = slots.size() - 1;
+        size_t hole = i;
+        for (size_t j = (i + 1) & mask; slots[j].count != 0; j = (j + 1) & mask) {
+            size_t home = hashOf(slots[j].key) & mask;
+            //   ,        (hole, j]
+            if (((j - home) & mask) >= ((j - hole) & mask)) {
+                slots[hole] = slots[j];
+                slots[j].count = 0;
+                hole = j;
+            }
+        }
+    }
+
+    size_t count(const T& value) const override {
+        return slots[find(normalize(value))].count;
+    }
+
+    void clear() override {
+        std::vector<Slot>(16).swap(slots);
+        used = 0;
+    }
+
+    size_t memoryUsage() const override {
+        return sizeof(*this) + slots.capacity() * sizeof(Slot);
+    }
+
+    MembershipIndex<T>* clone() const override {
+        return new FlatMembershipIndex(*this);
+    }
+
+private:
+    struct Slot {
+        T key = T();
+        size_t count = 0; // 0   
+    };
+
+    std::vector<Slot> slots; //    
+    size_t used;
+
+    ///  -0.0  +0.0,    ==   
+    static T normalize(T value) {
+        return value == T() ? T() : value;
+    }
+
+    ///    ( splitmix64)
+    static size_t hashOf(T key) {
+        std::uint64_t bits = 0;
+        std::memcpy(&bits, &key, sizeof(T) < sizeof(bits) ? sizeof(T) : sizeof(bits));
+        bits ^= bits >> 30;
+        bits *= 0xbf58476d1ce4e5b9ULL;
+        bits ^= bits >> 27;
+        bits *= 0x94d049bb133111ebULL;
+        bits ^= bits >> 31;
+        return static_cast<size_t>(bits);
+    }
+
+    ///          
+    size_t find(T key) const {
+        size_t mask = slots.size() - 1;
+        size_t i = hashOf(key) & mask;
+        while (slots[i].count != 0 && !(slots[i].key == key)) {
+            i = (i + 1) & mask;
+        }
+        return i;
+    }
+
+    ///     
+    void grow() {
+        std::vector<Slot> old(slots.size() * 2);
+        old.swap(slots);
+        size_t mask = slots.size() - 1;
+        for (const Slot& slot : old) {
+            if (slot.count != 0) {
+                size_t i = hashOf(slot.key) & mask;
+                while (slots[i].count != 0) {
+                    i = (i + 1) & mask;
+                }
+                slots[i] = slot;
+            }
+        }
+    }
+};
@@ -0,0 +1,213 @@
+#pragma once
+#include <cstddef>
+#include <functional> //  std::less, std::greater
+#include <type_traits> //  std::enable_if
+
+///      Heap::heapifyDown.
+///     : AVX2 (/arch:AVX2, -mavx2),
+/// SSE4.1 (/arch:AVX, -msse4.1)   . MEGAHEAP_NO_SIMD
+///   . Release-  MegaHeap
+///  MegaBench   /arch:AVX2;    AVX2 
+/// EnableEnhancedInstructionSet   (  ).
+///   GCC/Clang     -mavx2  -march=native.
+#if !defined(MEGAHEAP_NO_SIMD) && defined(__AVX2__)
+#define MEGAHEAP_SIMD_AVX2
+#define MEGAHEAP_SIMD_SSE41
+#include <immintrin.h>
+#elif !defined(MEGAHEAP_NO_SIMD) && (defined(__SSE4_1__) || defined(__AVX__))
+#define MEGAHEAP_SIMD_SSE41
+#include <smmintrin.h>
+#endif
+
+///  :    ( Less)    Arity 
+template <typename T, typename Less, size_t Arity>
+struct ScalarChildSelector {
+    static const bool vectorized = false;
+
+    static size_t select(const T* children, Less less) {
+        size_t best = 0;
+        for (size_t i = 1; i < Arity; ++i) {
+            if (less(children[best], children[i])) {
+                best = i;
+            }
+        }
+        return best;
+    }
+};
+
+///      T.     
+template <typename T, size_t Width>
+struct SimdOps {
+    static const bool supported = false;
+    static const size_t lanes = 1;
+};
+
+#ifdef MEGAHEAP_SIMD_SSE41
+/// 128 , 4 x int
+template <>
+struct SimdOps<int, 128> {
+    using Vector = __m128i;
+    static const bool supported = true;
+    static const size_t lanes = 4;
+
+    static Vector load(const int* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+    static Vector max(Vector a, Vector b) { return _mm_max_epi32(a, b); }
+    static Vector min(Vector a, Vector b) { return _mm_min_epi32(a, b); }
+    static Vector swapHalves(Vector a) { return _mm_shuffle_epi32(a, 0x4E); }
+    static Vector swapPairs(Vector a) { return _mm_shuffle_epi32(a, 0xB1); }
+    static int equalMask(Vector a, Vector b) { return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b))); }
+};
+
+/// 128 , 4 x float
+template <>
+struct SimdOps<float, 128> {
+    using Vector = __m128;
+    static const bool supported = true;
+    static const size_t lanes = 4;
+
+    static Vector load(const float* p) { return _mm_loadu_ps(p); }
+    static Vector max(Vector a, Vector b) { return _mm_max_ps(a, b); }
+    static Vector min(Vector a, Vector b) { return _mm_min_ps(a, b); }
+    static Vector swapHalves(Vector a) { return _mm_shuffle_ps(a, a, 0x4E); }
+    static Vector swapPairs(Vector a) { return _mm_shuffle_ps(a, a, 0xB1); }
+    static int equalMask(Vector a, Vector b) { return _mm_movemask_ps(_mm_cmpeq_ps(a, b)); }
+};
+
+/// 128 , 2 x double
+template <>
+struct SimdOps<double, 128> {
+    using Vector = __m128d;
+    static const bool supported = true;
+    static const size_t lanes = 2;
+
+    static Vector load(const double* p) { return _mm_loadu_pd(p); }
+    static Vector max(Vector a, Vector b) { return _mm_max_pd(a, b); }
+    static Vector min(Vector a, Vector b) { return _mm_min_pd(a, b); }
+    static Vector swapHalves(Vector a) { return _mm_shuffle_pd(a, a, 0x1); }
+    static Vector swapPairs(Vector a) { return a; }
+    static int equalMask(Vector a, Vector b) { return _mm_movemask_pd(_mm_cmpeq_pd(a, b)); }
+};
+#endif
+
+#ifdef MEGAHEAP_SIMD_AVX2
+/// 256 , 8 x int
+template <>
+struct SimdOps<int, 256> {
+    using Vector = __m256i;
+    static const bool supported = true;
+    static const size_t lanes = 8;
+
+    static Vector load(const int* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    static Vector max(Vector a, Vector b) { return _mm256_max_epi32(a, b); }
+    static Vector min(Vector a, Vector b) { return _mm256_min_epi32(a, b); }
+    static Vector swapQuads(Vector a) { return _mm256_permute2x128_si256(a, a, 0x01); }
+    static Vector swapHalves(Vector a) { return _mm256_shuffle_epi32(a, 0x4E); }
+    static Vector swapPairs(Vector a) { return _mm256_shuffle_epi32(a, 0xB1); }
+    static int equalMask(Vector a, Vector b) { return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b))); }
+};
+
+/// 256 , 8 x float
+template <>
+struct SimdOps<float, 256> {
+    using Vector = __m256;
+    static const bool supported = true;
+    static const size_t lanes = 8;
+
+    static Vector load(const float* p) { return _mm256_loadu_ps(p); }
+    static Vector max(Vector a, Vector b) { return _mm256_max_ps(a, b); }
+    static Vector min(Vector a, Vector b) { return _mm256_min_ps(a, b); }
+    static Vector swapQuads(Vector a) { return _mm256_permute2f128_ps(a, a, 0x01); }
+    static Vector swapHalves(Vector a) { return _mm256_shuffle_ps(a, a, 0x4E); }
+    static Vector swapPairs(Vector a) { return _mm256_shuffle_ps(a, a, 0xB1); }
+    static int equalMask(Vector a, Vector b) { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)); }
+};
+
+/// 256 , 4 x double
+template <>
+struct SimdOps<double, 256> {
+    using Vector = __m256d;
+    static const bool supported = true;
+    static const size_t lanes = 4;
+
+    static Vector load(const double* p) { return _mm256_loadu_pd(p); }
+    static Vector max(Vector a, Vector b) { return _mm256_max_pd(a, b); }
+    static Vector min(Vector a, Vector b) { return _mm256_min_pd(a, b); }
+    static Vector swapQuads(Vector a) { return _mm256_permute2f128_pd(a, a, 0x01); }
+    static Vector swapHalves(Vector a) { return _mm256_shuffle_pd(a, a, 0x5); }
+    static Vector swapPairs(Vector a) { return a; }
+    static int equalMask(Vector a, Vector b) { return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ)); }
+};
+#endif
+
+///    .    
+///   ,       
+///    ,  .     
+///    (    -0.0  +0.0). NaN    :
+///   std::less        .
+template <typename T, bool TakeMax, size_t Arity, size_t Width>
+struct SimdChildSelector {
+    using Ops = SimdOps<T, Width>;
+    using Vector = typename Ops::Vector;
+    static const bool vectorized = true;
+    static const size_t chunks = Arity / Ops::lanes;
+
+    static Vector pick(Vector a, Vector b) { return TakeMax ? Ops::max(a, b) : Ops::min(a, b); }
+
+    /// 128 :     
+    static Vector broadcast(Vector a, std::integral_constant<size_t, 128>) {
+        a = pick(a, Ops::swapHalves(a));
+        return pick(a, Ops::swapPairs(a));
+    }
+
+    /// 256 :    128- 
+    static Vector broadcast(Vector a, std::integral_constant<size_t, 256>) {
+        a = pick(a, Ops::swapQuads(a));
+        a = pick(a, Ops::swapHalves(a));
+        return pick(a, Ops::swapPairs(a));
+    }
+
+    template <typename Less>
+    static size_t select(const T* children, Less) {
+        Vector extreme = Ops::load(children);
+        for (size_t chunk = 1; chunk < chunks; ++chunk) {
+            extreme = pick(extreme, Ops::load(children + chunk * Ops::lanes));
+        }
+        extreme = broadcast(extreme, std::integral_constant<size_t, Width>());
+
+        for (size_t chunk = 0; chunk < chunks; ++chunk) {
+            int mask = Ops::equalMask(Ops::load(children + chunk * Ops::lanes), extreme);
+            if (mask != 0) {
+                size_t lane = 0;
+                while ((mask & 1) == 0) {
+                    mask >>= 1;
+                    ++lane;
+                }
+                return chunk * Ops::lanes + lane;
+            }
+        }
+        return 0;
+    }
+};
+
+///     : 256 ,      ,
+///  128 ,    ( 0)
+template <typename T, size_t Arity>
+struct SimdWidth {
+    static const size_t value =
+        (SimdOps<T, 256>::supported && Arity % SimdOps<T, 256>::lanes == 0) ? 256 :
+        (SimdOps<T, 128>::supported && Arity % SimdOps<T, 128>::lanes == 0) ? 128 : 0;
+};
+
+///        Arity .
+///  int, float  double  std::less / std::greater  Arity >= 4 
+///  ,     
+template <typename T, typename Less, size_t Arity, typename Enable = void>
+struct ChildSelector : ScalarChildSelector<T, Less, Arity> {};
+
+template <typename T, size_t Arity>
+struct ChildSelector<T, std::less<T>, Arity, typename std::enable_if<(Arity >= 4 && SimdWidth<T, Arity>::value != 0)>::type>
+    : SimdChildSelector<T, true, Arity, SimdWidth<T, Arity>::value> {};
+
+template <typename T, size_t Arity>
+struct ChildSelector<T, std::greater<T>, Arity, typename std::enable_if<(Arity >= 4 && SimdWidth<T, Arity>::value != 0)>::type>
+    : SimdChildSelector<T, false, Arity, SimdWidth<T, Arity>::value> {};
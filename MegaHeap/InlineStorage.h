@@ -0,0 +1,248 @@
+#pragma once
+#include <cstddef>
+#include <iterator> //  std::iterator_traits, std::distance
+#include <new> //  ::operator new, placement new
+#include <stdexcept> //  std::length_error
+#include <type_traits> //  std::aligned_storage
+#include <utility> //  std::move, std::forward
+#include "MegaHeap.h"
+
+///  InlineStorage    
+enum class InlineOverflow {
+    Spill, //     
+    Strict //   N  std::length_error,    
+};
+
+///      N     ( Storage  Heap).
+///     N,      , 
+///        malloc.
+///     Spill     ,
+///     .
+template <typename T, size_t N, InlineOverflow Overflow = InlineOverflow::Spill>
+class InlineStorage {
+    static_assert(N > 0, "InlineStorage capacity must be positive.");
+
+public:
+    using value_type = T;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    InlineStorage() : items(inlineItems()), count(0), cap(N) {}
+
+    ///   [first, last)
+    template <typename InputIt>
+    InlineStorage(InputIt first, InputIt last) : InlineStorage() {
+        insert(end(), first, last);
+    }
+
+    ///  
+    InlineStorage(const InlineStorage& other) : InlineStorage() {
+        insert(end(), other.begin(), other.end());
+    }
+
+    ///  :    ,
+    ///    
+    InlineStorage(InlineStorage&& other) noexcept : InlineStorage() {
+        takeFrom(other);
+    }
+
+    ///  
+    InlineStorage& operator=(const InlineStorage& other) {
+        if (this != &other) {
+            clear();
+            insert(end(), other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    ///  
+    InlineStorage& operator=(InlineStorage&& other) noexcept {
+        if (this != &other) {
+            clear();
+            release();
+            takeFrom(other);
+        }
+        return *this;
+    }
+
+    ~InlineStorage() {
+        clear();
+        release();
+    }
+
+    size_t size() const { return count; }
+    size_t capacity() const { return cap; }
+    bool empty() const { return count == 0; }
+
+    ///      
+    bool isInline() const { return items == inlineItems(); }
+
+    T* data() { return items; }
+    const T* data() const { return items; }
+    T* begin() { return items; }
+    T* end() { return items + count; }
+    const T* begin() const { return items; }
+    const T* end() const { return items + count; }
+    T& operator[](size_t i) { return items[i]; }
+    const T& operator[](size_t i) const { return items[i]; }
+    T& back() { return items[count - 1]; }
+    const T& back() const { return items[count - 1]; }
+
+    void push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    ///    .     
+    ///      ,       
+    template <typename... Args>
+    void emplace_back(Args&&... args) {
+        if (count < cap) {
+            new (items + count) T(std::forward<Args>(args)...);
+            ++count;
+            return;
+        }
+        size_t newCapacity = grownCapacity(count + 1);
+        T* fresh = allocate(newCapacity);
+        try {
+            new (fresh + count) T(std::forward<Args>(args)...);
+        }
+        catch (...) {
+            ::operator delete(fresh);
+            throw;
+        }
+        relocate(fresh, newCapacity);
+        ++count;
+    }
+
+    void pop_back() {
+        --count;
+        items[count].~T();
+    }
+
+    ///   ;   ( ) 
+    void clear() {
+        for (size_t i = 0; i < count; ++i) {
+            items[i].~T();
+        }
+        count = 0;
+    }
+
+    ///    newCapacity 
+    void reserve(size_t newCapacity) {
+        if (newCapacity <= cap) {
+            return;
+        }
+        T* fresh = allocate(newCapacity);
+        relocate(fresh, newCapacity);
+    }
+
+    ///  ;     .
+    ///      ,   
+    /// Strict     
+    template <typename InputIt>
+    T* insert(T* position, InputIt first, InputIt last) {
+        size_t offset = static_cast<size_t>(position - items);
+        if (offset != count) {
+            throw std::out_of_range("InlineStorage supports appending only!");
+        }
+        append(first, last, typename std::iterator_traits<InputIt>::iterator_category());
+        return items + offset;
+    }
+
+    void swap(InlineStorage& other) noexcept {
+        if (this == &other) {
+            return;
+        }
+        InlineStorage temp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(temp);
+    }
+
+private:
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type buffer[N]; //  
+    T* items; //    
+    size_t count;
+    size_t cap;
+
+    T* inlineItems() { return reinterpret_cast<T*>(buffer); }
+    const T* inlineItems() const { return reinterpret_cast<const T*>(buffer); }
+
+    ///   : ,    
+    size_t grownCapacity(size_t required) const {
+        return required > 2 * cap ? required : 2 * cap;
+    }
+
+    ///   ;   Strict   
+    T* allocate(size_t newCapacity) const {
+        if (Overflow == InlineOverflow::Strict) {
+            throw std::length_error("InlineStorage capacity exceeded!");
+        }
+        return static_cast<T*>(::operator new(newCapacity * sizeof(T)));
+    }
+
+    ///        
+    void relocate(T* fresh, size_t newCapacity) {
+        for (size_t i = 0; i < count; ++i) {
+            new (fresh + i) T(std::move(items[i]));
+            items[i].~T();
+        }
+        release();
+        items = fresh;
+        cap = newCapacity;
+    }
+
+    ///    (    )
+    void release() {
+        if (!isInline()) {
+            ::operator delete(items);
+            items = inlineItems();
+            cap = N;
+        }
+    }
+
+    ///   other; this     
+    void takeFrom(InlineStorage& other) {
+        if (other.isInline()) {
+            for (size_t i = 0; i < other.count; ++i) {
+                new (items + i) T(std::move(other.items[i]));
+            }
+            count = other.count;
+            other.clear();
+        }
+        else {
+            items = other.items;
+            count = other.count;
+            cap = other.cap;
+            other.items = other.inlineItems();
+            other.count = 0;
+            other.cap = N;
+        }
+    }
+
+    template <typename InputIt>
+    void append(InputIt first, InputIt last, std::input_iterator_tag) {
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
+
+    template <typename ForwardIt>
+    void append(ForwardIt first, ForwardIt last, std::forward_iterator_tag) {
+        size_t added = static_cast<size_t>(std::distance(first, last));
+        if (count + added > cap) {
+            reserve(grownCapacity(count + added));
+        }
+        for (; first != last; ++first) {
+            new (items + count) T(*first);
+            ++count;
+        }
+    }
+};
+
+///    :  N      
+template <typename T, size_t N, typename Compare = std::less<T>, size_t Arity = 2, InlineOverflow Overflow = InlineOverflow::Spill>
+using SmallHeap = Heap<T, Compare, Arity, InlineStorage<T, N, Overflow>>;
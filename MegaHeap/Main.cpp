@@ -2,7 +2,23 @@
 #include <cassert>
 #include <vector>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <functional>
+#include <cstdlib>
+#include <cstdio> //  std::remove
+#include <map>
+#include <iterator>
+#include <thread>
+#include <mutex>
 #include "MegaHeap.h"
+#include "ConcurrentHeap.h"
+#include "MappedStorage.h"
+#include "InlineStorage.h"
 
 using namespace std;
 
@@ -154,9 +170,1369 @@ void testHeapSort() {
     std::cout << "All tests passed!\n";
 }
 
+void testHeapBuild() {
+    // :    
+    Heap<int> emptyHeap(std::vector<int>{});
+    assert(emptyHeap.empty());
+
+    // :   ,     push
+    std::vector<int> values = { 3, 41, -7, 15, 41, 0, 99, -100, 8, 23, 15 };
+    Heap<int> built(values);
+    Heap<int> pushed;
+    for (int val : values) {
+        pushed.push(val);
+    }
+    assert(built.size() == values.size());
+    while (!built.empty()) {
+        assert(built.top() == pushed.top());
+        built.pop();
+        pushed.pop();
+    }
+
+    // :      
+    std::vector<int> buffer;
+    for (int i = 0; i < 1000; ++i) {
+        buffer.push_back((i * 7919) % 1000);
+    }
+    Heap<int> adopted(std::move(buffer));
+    assert(adopted.size() == 1000);
+    assert(adopted.top() == 999);
+    for (int i = 999; i >= 0; --i) {
+        assert(adopted.top() == i);
+        adopted.pop();
+    }
+}
+
+void testHeapSortInPlace() {
+    // :     
+    std::vector<int> buffer;
+    Heap<int>::sortInPlace(buffer, SortOrder::Ascending);
+    assert(buffer.empty());
+    buffer = { 5 };
+    Heap<int>::sortInPlace(buffer, SortOrder::Descending);
+    assert(buffer == std::vector<int>{5});
+
+    // :        std::sort
+    std::mt19937 rng(7);
+    std::vector<int> values(500);
+    for (int& val : values) {
+        val = static_cast<int>(rng() % 200) - 100; //    
+    }
+    std::vector<int> expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    buffer = values;
+    Heap<int>::sortInPlace(buffer, SortOrder::Ascending);
+    assert(buffer == expected);
+
+    buffer = values;
+    Heap<int>::sortInPlace(buffer.begin(), buffer.end(), SortOrder::Descending);
+    assert(std::equal(buffer.begin(), buffer.end(), expected.rbegin()));
+
+    // :    
+    double raw[] = { 2.5, -1.0, 7.25, 0.0, 3.5 };
+    Heap<double>::sortInPlace(raw, raw + 5, SortOrder::Ascending);
+    assert(raw[0] == -1.0 && raw[1] == 0.0 && raw[2] == 2.5 && raw[3] == 3.5 && raw[4] == 7.25);
+
+    // :  , k   
+    for (size_t k : { 0u, 1u, 10u, 499u, 500u }) {
+        buffer = values;
+        Heap<int>::partialSort(buffer.begin(), buffer.begin() + k, buffer.end(), SortOrder::Descending);
+        assert(std::equal(buffer.begin(), buffer.begin() + k, expected.rbegin()));
+
+        buffer = values;
+        Heap<int>::partialSort(buffer.begin(), buffer.begin() + k, buffer.end(), SortOrder::Ascending);
+        assert(std::equal(buffer.begin(), buffer.begin() + k, expected.begin()));
+    }
+
+    // :       MinHeap Descending    
+    buffer = values;
+    Heap<int, std::greater<int>>::sortInPlace(buffer, SortOrder::Descending);
+    assert(buffer == expected);
+    buffer = values;
+    Heap<int, std::greater<int>>::partialSort(buffer.begin(), buffer.begin() + 10, buffer.end(), SortOrder::Descending);
+    assert(std::equal(buffer.begin(), buffer.begin() + 10, expected.begin()));
+
+    // :     
+    auto byAbs = [](int a, int b) { return std::abs(a) < std::abs(b); };
+    buffer = values;
+    Heap<int, decltype(byAbs)>::sortInPlace(buffer, SortOrder::Ascending, byAbs);
+    assert(std::is_sorted(buffer.begin(), buffer.end(), byAbs));
+    buffer = values;
+    Heap<int, decltype(byAbs)>::sortInPlace(buffer.begin(), buffer.end(), SortOrder::Descending, byAbs);
+    assert(std::is_sorted(buffer.rbegin(), buffer.rend(), byAbs));
+}
+
+//      
+struct Job {
+    int priority;
+    std::string name;
+};
+
+//   MinHeap  
+struct JobLater {
+    bool operator()(const Job& a, const Job& b) const {
+        return a.priority > b.priority;
+    }
+};
+
+void testHeapCompare() {
+    // : MinHeap  std::greater
+    Heap<int, std::greater<int>> minHeap;
+    for (int val : { 5, -3, 12, 0, 7, -3 }) {
+        minHeap.push(val);
+    }
+    assert(minHeap.top() == -3);
+    minHeap.pop();
+    assert(minHeap.top() == -3);
+    minHeap.pop();
+    assert(minHeap.top() == 0);
+
+    // :  MinHeap  
+    Heap<int, std::greater<int>> builtMin(std::vector<int>{ 9, 4, 6, 1, 8 });
+    std::vector<int> drained;
+    while (!builtMin.empty()) {
+        drained.push_back(builtMin.top());
+        builtMin.pop();
+    }
+    assert((drained == std::vector<int>{ 1, 4, 6, 8, 9 }));
+
+    // :       
+    Heap<Job, JobLater> jobs;
+    jobs.push({ 3, "compile" });
+    jobs.push({ 1, "fetch" });
+    jobs.push({ 2, "link" });
+    assert(jobs.top().name == "fetch");
+    jobs.pop();
+    assert(jobs.top().name == "link");
+    jobs.pop();
+    assert(jobs.top().name == "compile");
+    jobs.pop();
+    assert(jobs.empty());
+
+    // :    (   )
+    auto byAbs = [](int a, int b) { return std::abs(a) < std::abs(b); };
+    Heap<int, decltype(byAbs)> absHeap(byAbs);
+    absHeap.push(-10);
+    absHeap.push(4);
+    absHeap.push(7);
+    assert(absHeap.top() == -10);
+
+    // :   
+    auto byPointee = [](const std::unique_ptr<int>& a, const std::unique_ptr<int>& b) { return *a < *b; };
+    Heap<std::unique_ptr<int>, decltype(byPointee)> owners(byPointee);
+    owners.push(std::unique_ptr<int>(new int(2)));
+    owners.push(std::unique_ptr<int>(new int(11)));
+    owners.push(std::unique_ptr<int>(new int(5)));
+    assert(*owners.top() == 11);
+    owners.pop();
+    assert(*owners.top() == 5);
+}
+
+template <size_t Arity>
+void checkArityMatchesBinary(const std::vector<int>& values) {
+    Heap<int> binary;
+    Heap<int, std::less<int>, Arity> wide;
+    for (int val : values) {
+        binary.push(val);
+        wide.push(val);
+    }
+    assert(wide.size() == binary.size());
+    while (!binary.empty()) {
+        assert(wide.top() == binary.top());
+        binary.pop();
+        wide.pop();
+    }
+    assert(wide.empty());
+}
+
+void testHeapArity() {
+    std::mt19937 rng(13);
+    std::vector<int> values(2000);
+    for (int& val : values) {
+        val = static_cast<int>(rng() % 1000);
+    }
+
+    // : 3-, 4-  8-     ,   
+    checkArityMatchesBinary<3>(values);
+    checkArityMatchesBinary<4>(values);
+    checkArityMatchesBinary<8>(values);
+
+    // :        
+    std::vector<int> copy = values;
+    Heap<int, std::greater<int>, 4> minHeap(std::move(copy));
+    std::vector<int> expected = values;
+    std::sort(expected.begin(), expected.end());
+    for (int val : expected) {
+        assert(minHeap.top() == val);
+        minHeap.pop();
+    }
+
+    // :    4- 
+    std::vector<int> buffer = values;
+    Heap<int, std::less<int>, 4>::sortInPlace(buffer, SortOrder::Ascending);
+    assert(buffer == expected);
+
+    // :       -
+    CacheAlignedAllocator<double> allocator;
+    for (size_t n : { 1u, 7u, 1000u }) {
+        double* block = allocator.allocate(n);
+        assert(reinterpret_cast<std::uintptr_t>(block + 1) % 64 == 0);
+        allocator.deallocate(block, n);
+    }
+}
+
+template <typename T, typename Less, size_t Arity>
+void checkChildSelector(std::mt19937& rng) {
+    T group[Arity];
+    for (int round = 0; round < 2000; ++round) {
+        for (T& val : group) {
+            val = static_cast<T>(static_cast<int>(rng() % 7) - 3); //   
+        }
+        if (round % 5 == 0) {
+            group[rng() % Arity] = static_cast<T>(-0.0); // -0.0  +0.0 
+        }
+        size_t expected = ScalarChildSelector<T, Less, Arity>::select(group, Less());
+        assert((ChildSelector<T, Less, Arity>::select(group, Less()) == expected));
+    }
+}
+
+void testHeapSimd() {
+    std::mt19937 rng(21);
+
+    // :       (  )
+    checkChildSelector<int, std::less<int>, 4>(rng);
+    checkChildSelector<int, std::less<int>, 8>(rng);
+    checkChildSelector<int, std::greater<int>, 16>(rng);
+    checkChildSelector<float, std::less<float>, 8>(rng);
+    checkChildSelector<float, std::greater<float>, 4>(rng);
+    checkChildSelector<double, std::less<double>, 4>(rng);
+    checkChildSelector<double, std::greater<double>, 8>(rng);
+
+    // : 8-  double      
+    std::vector<double> values(3000);
+    for (double& val : values) {
+        val = static_cast<double>(rng() % 500) / 4.0 - 60.0;
+    }
+    Heap<double, std::less<double>, 8> heap(values);
+    std::vector<double> expected = values;
+    std::sort(expected.begin(), expected.end(), std::greater<double>());
+    for (double val : expected) {
+        assert(heap.top() == val);
+        heap.pop();
+    }
+
+    // :    float
+    std::vector<float> floats(1000);
+    for (float& val : floats) {
+        val = static_cast<float>(rng() % 300) - 150.0f;
+    }
+    std::vector<float> sortedFloats = floats;
+    std::sort(sortedFloats.begin(), sortedFloats.end());
+    Heap<float, std::less<float>, 16>::sortInPlace(floats, SortOrder::Ascending);
+    assert(floats == sortedFloats);
+
+    std::cout << "Heap child selection: "
+        << (ChildSelector<int, std::less<int>, 8>::vectorized ? "SIMD" : "scalar") << "\n";
+}
+
+// ,   
+struct Tracked {
+    static int copies;
+
+    explicit Tracked(int key = 0) : key(key) {}
+    Tracked(const Tracked& other) : key(other.key) { ++copies; }
+    Tracked(Tracked&&) noexcept = default;
+    Tracked& operator=(const Tracked& other) { key = other.key; ++copies; return *this; }
+    Tracked& operator=(Tracked&&) noexcept = default;
+
+    bool operator<(const Tracked& other) const { return key < other.key; }
+    bool operator>(const Tracked& other) const { return key > other.key; }
+
+    int key;
+};
+
+int Tracked::copies = 0;
+
+//    :  
+struct PointeeLess {
+    bool operator()(const std::unique_ptr<int>& a, const std::unique_ptr<int>& b) const {
+        return *a < *b;
+    }
+};
+
+void testHeapMove() {
+    // : emplace, popTop     
+    std::mt19937 rng(15);
+    std::vector<int> keys(1000);
+    for (int& key : keys) {
+        key = static_cast<int>(rng() % 500);
+    }
+    Tracked::copies = 0;
+    Heap<Tracked, std::less<Tracked>, 4> heap;
+    for (int key : keys) {
+        heap.emplace(key);
+    }
+    heap.push(Tracked(1000));
+    heap.replaceTop(Tracked(-1));
+    std::vector<int> popped;
+    while (!heap.empty()) {
+        popped.push_back(heap.popTop().key);
+    }
+    std::vector<int> expected = keys;
+    expected.push_back(-1);
+    std::sort(expected.begin(), expected.end(), std::greater<int>());
+    assert(popped == expected);
+
+    std::vector<Tracked> items;
+    for (int key : keys) {
+        items.emplace_back(key);
+    }
+    Heap<Tracked>::sortInPlace(items, SortOrder::Ascending);
+    assert(std::is_sorted(items.begin(), items.end()));
+    Heap<Tracked>::partialSort(items.begin(), items.begin() + 10, items.end(), SortOrder::Descending);
+    for (size_t i = 0; i < 10; ++i) {
+        assert(items[i].key == expected[i]);
+    }
+    assert(Tracked::copies == 0);
+
+    // :   ,   
+    Heap<std::unique_ptr<int>, PointeeLess> owners;
+    for (int value : { 3, 8, 1, 6 }) {
+        owners.emplace(new int(value));
+    }
+    owners.push(std::unique_ptr<int>(new int(7)));
+    std::unique_ptr<int> best = owners.popTop();
+    assert(*best == 8 && *owners.top() == 7 && owners.size() == 4);
+    owners.pop();
+    assert(*owners.popTop() == 6 && *owners.popTop() == 3 && *owners.popTop() == 1);
+
+    // :  
+    bool caught = false;
+    try {
+        owners.popTop();
+    }
+    catch (const std::runtime_error&) {
+        caught = true;
+    }
+    assert(caught);
+}
+
+void testHeapBatch() {
+    std::mt19937 rng(5);
+    std::vector<int> values(5000);
+    for (int& val : values) {
+        val = static_cast<int>(rng() % 10000) - 5000;
+    }
+
+    // :   ( )    ()
+    Heap<int> heap;
+    heap.pushRange(values.begin(), values.begin() + 4000);
+    heap.pushRange(values.begin() + 4000, values.begin() + 4010);
+    heap.pushRange(values.begin() + 4010, values.end());
+    heap.pushRange(values.end(), values.end());
+    assert(heap.size() == values.size());
+
+    std::vector<int> expected = values;
+    std::sort(expected.begin(), expected.end(), std::greater<int>());
+
+    // :    
+    std::vector<int> drained(100);
+    auto end = heap.popN(100, drained.begin());
+    assert(end == drained.end());
+    assert(std::equal(drained.begin(), drained.end(), expected.begin()));
+    assert(heap.size() == values.size() - 100);
+    assert(heap.top() == expected[100]);
+
+    // :  ,  ,    
+    std::vector<int> rest;
+    heap.popN(values.size(), std::back_inserter(rest));
+    assert(heap.empty());
+    assert(std::equal(rest.begin(), rest.end(), expected.begin() + 100));
+
+    // : 4- MinHeap
+    Heap<int, std::greater<int>, 4> minHeap;
+    minHeap.pushRange(values.begin(), values.end());
+    int smallest[3];
+    minHeap.popN(3, smallest);
+    assert(smallest[0] == expected[values.size() - 1]);
+    assert(smallest[2] == expected[values.size() - 3]);
+}
+
+void testHeapMerge() {
+    std::mt19937 rng(17);
+    std::vector<int> left(3000), right(200);
+    for (int& val : left) {
+        val = static_cast<int>(rng() % 5000);
+    }
+    for (int& val : right) {
+        val = static_cast<int>(rng() % 5000);
+    }
+    std::vector<int> expected = left;
+    expected.insert(expected.end(), right.begin(), right.end());
+    std::sort(expected.begin(), expected.end(), std::greater<int>());
+
+    // :       
+    for (int order = 0; order < 2; ++order) {
+        Heap<int> a(order == 0 ? left : right);
+        Heap<int> b(order == 0 ? right : left);
+        a.merge(std::move(b));
+        assert(b.empty());
+        assert(a.size() == expected.size());
+        std::vector<int> drained;
+        a.popN(a.size(), std::back_inserter(drained));
+        assert(drained == expected);
+    }
+
+    // :    
+    Heap<int> empty;
+    Heap<int> full(left);
+    empty.merge(std::move(full));
+    assert(empty.size() == left.size() && full.empty());
+
+    // :  
+    PairingHeap<int> pairing;
+    assert(pairing.empty());
+    for (int val : left) {
+        pairing.push(val);
+    }
+    PairingHeap<int> other;
+    for (int val : right) {
+        other.push(val);
+    }
+    pairing.merge(std::move(other));
+    assert(other.empty() && other.size() == 0);
+    assert(pairing.size() == expected.size());
+    for (size_t i = 0; i < expected.size() / 2; ++i) {
+        assert(pairing.top() == expected[i]);
+        pairing.pop();
+    }
+
+    // :      
+    PairingHeap<int> moved(std::move(pairing));
+    assert(pairing.empty());
+    assert(moved.top() == expected[expected.size() / 2]);
+    moved.clear();
+    assert(moved.empty());
+
+    // :  MinHeap  
+    PairingHeap<Job, JobLater> jobs;
+    jobs.push({ 2, "b" });
+    jobs.push({ 1, "a" });
+    PairingHeap<Job, JobLater> more;
+    more.push({ 0, "first" });
+    jobs.merge(std::move(more));
+    assert(jobs.top().name == "first");
+    jobs.pop();
+    assert(jobs.top().name == "a");
+
+    bool caught = false;
+    try {
+        PairingHeap<int> none;
+        none.pop();
+    }
+    catch (const std::runtime_error&) {
+        caught = true;
+    }
+    assert(caught);
+}
+
+void testTopK() {
+    std::mt19937 rng(123);
+    std::vector<int> stream(100000);
+    for (int& val : stream) {
+        val = static_cast<int>(rng() % 1000000) - 500000;
+    }
+    std::vector<int> expected = stream;
+    std::sort(expected.begin(), expected.end(), std::greater<int>());
+
+    // : k   ,    
+    TopK<int> top(50);
+    top.offerRange(stream.begin(), stream.end());
+    assert(top.size() == 50);
+    assert(top.threshold() == expected[49]);
+    std::vector<int> best = top.extract();
+    assert(std::equal(best.begin(), best.end(), expected.begin()));
+    assert(top.size() == 0);
+
+    // :    
+    TopK<int> three(3);
+    for (int val : { 5, 1, 9, 7 }) {
+        three.offer(val);
+    }
+    assert(three.threshold() == 5);
+    assert(!three.offer(4));
+    assert(three.offer(6));
+    assert((three.extract() == std::vector<int>{ 9, 7, 6 }));
+
+    // : k   std::greater  4- 
+    TopK<int, std::greater<int>, 4> smallest(10);
+    smallest.offerRange(stream.begin(), stream.end());
+    std::vector<int> low = smallest.extract();
+    assert(std::equal(low.begin(), low.end(), expected.rbegin()));
+
+    // :      k
+    TopK<Job, JobLater> urgent(5);
+    urgent.offer({ 4, "d" });
+    urgent.offer({ 2, "b" });
+    std::vector<Job> jobs = urgent.extract();
+    assert(jobs.size() == 2 && jobs[0].name == "b" && jobs[1].name == "d");
+
+    // : k = 0   
+    TopK<int> none(0);
+    assert(!none.offer(1));
+    assert(none.size() == 0);
+}
+
+void testHeapMembershipIndex() {
+    Heap<int> heap;
+    assert(!heap.hasIndex() && heap.indexMemoryUsage() == 0);
+    for (int val : { 4, 8, 8, 15, 16, 23, 42 }) {
+        heap.push(val);
+    }
+
+    // :     
+    heap.enableIndex();
+    assert(heap.hasIndex());
+    assert(heap.count(8) == 2 && heap.find(42) && !heap.find(5));
+    std::cout << "Heap membership index: " << heap.indexMemoryUsage() << " bytes for "
+        << heap.size() << " elements\n";
+
+    // :    pop, replaceTop, pushRange, popN
+    heap.pop(); // 42
+    assert(!heap.find(42));
+    heap.replaceTop(8); // 23 -> 8
+    assert(!heap.find(23) && heap.count(8) == 3);
+    std::vector<int> batch = { 1, 1, 100 };
+    heap.pushRange(batch.begin(), batch.end());
+    assert(heap.count(1) == 2 && heap.find(100));
+    int drained[2];
+    heap.popN(2, drained); // 100, 16
+    assert(!heap.find(100) && !heap.find(16));
+
+    // :     ,   
+    Heap<int> other(std::vector<int>{ 7, 7, 1 });
+    other.enableIndex();
+    heap.merge(std::move(other));
+    assert(heap.count(7) == 2 && heap.count(1) == 3);
+    assert(other.empty() && !other.find(7));
+
+    // :         
+    Heap<int> few(std::vector<int>{ 2 });
+    few.enableIndex();
+    few.merge(Heap<int>(std::vector<int>{ 9, 5, 5 }));
+    assert(few.count(5) == 2 && few.find(9) && few.find(2));
+
+    // :        
+    SmallHeap<int, 4, std::less<int>, 2, InlineOverflow::Strict> bounded;
+    for (int val : { 1, 2, 3 }) {
+        bounded.push(val);
+    }
+    bounded.enableIndex();
+    SmallHeap<int, 4, std::less<int>, 2, InlineOverflow::Strict> incoming;
+    incoming.push(8);
+    incoming.push(9);
+    bool caught = false;
+    try {
+        bounded.merge(std::move(incoming));
+    }
+    catch (const std::length_error&) {
+        caught = true;
+    }
+    assert(caught && bounded.size() == 3 && bounded.top() == 3);
+    assert(!bounded.find(8) && !bounded.find(9) && bounded.count(3) == 1);
+
+    // :      (  ) 
+    SmallHeap<int, 4, std::less<int>, 2, InlineOverflow::Strict> single;
+    single.push(1);
+    single.enableIndex();
+    SmallHeap<int, 4, std::less<int>, 2, InlineOverflow::Strict> four;
+    for (int val : { 5, 6, 7, 8 }) {
+        four.push(val);
+    }
+    caught = false;
+    try {
+        single.merge(std::move(four));
+    }
+    catch (const std::length_error&) {
+        caught = true;
+    }
+    assert(caught && single.size() == 1 && single.top() == 1);
+    assert(single.find(1) && !single.find(8));
+    assert(four.size() == 4 && four.top() == 8);
+
+    // :    
+    Heap<int> copy(heap);
+    copy.clear();
+    assert(!copy.find(7) && heap.find(7));
+
+    // :    
+    std::vector<int> rest;
+    heap.popN(heap.size(), std::back_inserter(rest));
+    assert(!heap.find(8) && heap.count(1) == 0);
+
+    // : -0.0  +0.0   ,    ==
+    Heap<double> doubles;
+    doubles.enableIndex();
+    doubles.push(-0.0);
+    assert(doubles.find(0.0));
+
+    // :   -  
+    Heap<std::string> names;
+    names.push("b");
+    names.enableIndex();
+    names.push("a");
+    names.push("b");
+    assert(names.count("b") == 2 && names.find("a"));
+    names.pop(); // "b"
+    assert(names.count("b") == 1);
+    assert(names.indexMemoryUsage() > 0);
+
+    // :     
+    Heap<int, std::less<int>, 4> checked;
+    checked.enableIndex();
+    std::mt19937 rng(31);
+    for (int step = 0; step < 20000; ++step) {
+        if (rng() % 3 != 0 || checked.empty()) {
+            checked.push(static_cast<int>(rng() % 300));
+        }
+        else {
+            checked.pop();
+        }
+        if (step % 97 == 0) {
+            Heap<int, std::less<int>, 4> plain(checked);
+            plain.disableIndex();
+            for (int probe = 0; probe < 300; ++probe) {
+                assert(checked.count(probe) == plain.count(probe));
+            }
+        }
+    }
+}
+
+void testIndexedHeap() {
+    IndexedHeap<int> heap;
+
+    // :    
+    auto a = heap.push(10);
+    auto b = heap.push(30);
+    auto c = heap.push(20);
+    assert(heap.size() == 3);
+    assert(heap.top() == 30 && heap.topHandle() == b);
+    assert(heap.get(a) == 10 && heap.get(c) == 20);
+
+    // :    
+    heap.update(a, 50);
+    assert(heap.topHandle() == a);
+    heap.update(a, 5);
+    assert(heap.topHandle() == b);
+    assert(heap.get(a) == 5);
+
+    // :   
+    heap.erase(b);
+    assert(!heap.contains(b));
+    assert(heap.top() == 20);
+    heap.pop();
+    assert(!heap.contains(c));
+    assert(heap.top() == 5 && heap.size() == 1);
+
+    // :  
+    bool caught = false;
+    try {
+        heap.update(c, 1);
+    }
+    catch (const std::out_of_range&) {
+        caught = true;
+    }
+    assert(caught);
+
+    // :    
+    IndexedHeap<int, std::greater<int>, 4> minHeap;
+    std::map<size_t, int> reference;
+    std::mt19937 rng(99);
+    for (int step = 0; step < 20000; ++step) {
+        int op = static_cast<int>(rng() % 4);
+        if (op == 0 || reference.empty()) {
+            int val = static_cast<int>(rng() % 1000);
+            reference[minHeap.push(val)] = val;
+        }
+        else {
+            auto it = reference.begin();
+            std::advance(it, rng() % reference.size());
+            if (op == 1) {
+                int val = static_cast<int>(rng() % 1000);
+                minHeap.update(it->first, val);
+                it->second = val;
+            }
+            else if (op == 2) {
+                minHeap.erase(it->first);
+                reference.erase(it);
+            }
+            else {
+                reference.erase(minHeap.topHandle());
+                minHeap.pop();
+            }
+        }
+        assert(minHeap.size() == reference.size());
+        if (!reference.empty()) {
+            int expected = reference.begin()->second;
+            for (const auto& entry : reference) {
+                expected = std::min(expected, entry.second);
+            }
+            assert(minHeap.top() == expected);
+            assert(reference[minHeap.topHandle()] == expected);
+        }
+    }
+}
+
+// ,       (   )
+template <typename Storage>
+bool isMaxHeap(const Storage& storage, size_t arity) {
+    for (size_t i = 1; i < storage.size(); ++i) {
+        if (storage[(i - 1) / arity] < storage[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void testMappedHeap() {
+    using Storage = MappedStorage<int, 4>;
+    using MappedHeap = Heap<int, std::less<int>, 4, Storage>;
+    const std::string path = "megaheap_test.heap";
+    std::remove(path.c_str());
+
+    // :    ,    
+    std::vector<int> reference;
+    std::mt19937 rng(12);
+    {
+        MappedHeap heap(HeapOrderedTag{}, Storage(path, MappedSyncMode::None, 4));
+        for (int i = 0; i < 1000; ++i) {
+            int value = static_cast<int>(rng() % 5000);
+            heap.push(value);
+            reference.push_back(value);
+        }
+        std::vector<int> batch(500);
+        for (int& value : batch) {
+            value = static_cast<int>(rng() % 5000);
+        }
+        heap.pushRange(batch.begin(), batch.end());
+        reference.insert(reference.end(), batch.begin(), batch.end());
+        std::sort(reference.begin(), reference.end(), std::greater<int>());
+
+        std::vector<int> popped(100);
+        heap.popN(popped.size(), popped.begin());
+        assert(std::equal(popped.begin(), popped.end(), reference.begin()));
+        reference.erase(reference.begin(), reference.begin() + 100);
+    }
+    {
+        MappedHeap heap(HeapOrderedTag{}, Storage(path));
+        assert(heap.size() == reference.size());
+        assert(heap.top() == reference.front());
+        std::vector<int> rest(heap.size());
+        heap.popN(rest.size(), rest.begin());
+        assert(rest == reference);
+        assert(heap.empty());
+    }
+
+    // :     
+    {
+        MappedHeap heap(HeapOrderedTag{}, Storage(path, MappedSyncMode::Journal));
+        for (int i = 0; i < 300; ++i) {
+            heap.push(static_cast<int>(rng() % 1000));
+        }
+        heap.replaceTop(-1);
+        heap.pop();
+        std::vector<int> popped(10);
+        heap.popN(popped.size(), popped.begin());
+        assert(std::is_sorted(popped.begin(), popped.end(), std::greater<int>()));
+        assert(heap.size() == 289);
+    }
+
+    // :     
+    std::vector<int> snapshot;
+    {
+        Storage storage(path, MappedSyncMode::Journal);
+        assert(isMaxHeap(storage, 4));
+        snapshot.assign(storage.begin(), storage.end());
+        size_t slots[] = { 0, 1, storage.size() };
+        storage.beginUpdate(slots, 3);
+        storage[0] = -100;
+        storage[1] = 100000;
+        storage.push_back(7);
+        // : commitUpdate  
+    }
+    {
+        Storage storage(path, MappedSyncMode::Journal);
+        assert(std::vector<int>(storage.begin(), storage.end()) == snapshot);
+    }
+
+    // :  Sync    ,     
+    std::remove(path.c_str());
+    std::vector<int> synced;
+    {
+        MappedHeap heap(HeapOrderedTag{}, Storage(path, MappedSyncMode::Sync, 16));
+        for (int i = 0; i < 5000; ++i) {
+            int value = static_cast<int>(rng() % 100000);
+            heap.push(value);
+            synced.push_back(value);
+        }
+        std::vector<int> batch(3000);
+        for (int& value : batch) {
+            value = static_cast<int>(rng() % 100000);
+        }
+        heap.pushRange(batch.begin(), batch.end());
+        synced.insert(synced.end(), batch.begin(), batch.end());
+        std::sort(synced.begin(), synced.end(), std::greater<int>());
+        heap.replaceTop(synced.back() - 1);
+        synced.erase(synced.begin());
+        synced.push_back(synced.back() - 1);
+        heap.pop();
+        synced.erase(synced.begin());
+        std::vector<int> popped(50);
+        heap.popN(popped.size(), popped.begin());
+        assert(std::equal(popped.begin(), popped.end(), synced.begin()));
+        synced.erase(synced.begin(), synced.begin() + 50);
+        heap.push(200000);
+        synced.insert(synced.begin(), 200000);
+    }
+    {
+        Storage storage(path, MappedSyncMode::Sync);
+        assert(storage.size() == synced.size());
+        assert(isMaxHeap(storage, 4));
+        MappedHeap heap(HeapOrderedTag{}, std::move(storage));
+        std::vector<int> rest(heap.size());
+        heap.popN(rest.size(), rest.begin());
+        assert(rest == synced);
+    }
+
+    // :     ,   
+    const std::string otherPath = "megaheap_test_other.heap";
+    std::remove(path.c_str());
+    std::remove(otherPath.c_str());
+    for (int order = 0; order < 2; ++order) {
+        std::vector<int> small = { 3, 1, 2 };
+        std::vector<int> large = { 10, 40, 20, 30, 50, 60 };
+        {
+            MappedHeap a(HeapOrderedTag{}, Storage(path));
+            MappedHeap b(HeapOrderedTag{}, Storage(otherPath));
+            a.pushRange((order == 0 ? small : large).begin(), (order == 0 ? small : large).end());
+            b.pushRange((order == 0 ? large : small).begin(), (order == 0 ? large : small).end());
+            a.merge(std::move(b));
+            assert(a.size() == 9 && b.empty() && a.top() == 60);
+        }
+        MappedHeap a(HeapOrderedTag{}, Storage(path));
+        MappedHeap b(HeapOrderedTag{}, Storage(otherPath));
+        assert(a.size() == 9 && b.size() == 0);
+        std::vector<int> merged(a.size());
+        a.popN(merged.size(), merged.begin());
+        assert(merged == std::vector<int>({ 60, 50, 40, 30, 20, 10, 3, 2, 1 }));
+    }
+    std::remove(otherPath.c_str());
+
+    // :      
+    bool caught = false;
+    try {
+        MappedStorage<int, 2> wrong(path);
+    }
+    catch (const std::runtime_error&) {
+        caught = true;
+    }
+    assert(caught);
+
+    std::remove(path.c_str());
+}
+
+void testRadixHeap() {
+    RadixHeap<int> heap;
+
+    // :   ,     
+    for (int value : { 5, -3, 12, 0, -3, 7 }) {
+        heap.push(value);
+    }
+    assert(heap.size() == 6 && heap.top() == -3);
+    std::vector<int> order;
+    while (!heap.empty()) {
+        order.push_back(heap.top());
+        heap.pop();
+    }
+    assert(order == std::vector<int>({ -3, -3, 0, 5, 7, 12 }));
+
+    // :     
+    heap.push(20);
+    heap.pop();
+    bool caught = false;
+    try {
+        heap.push(19);
+    }
+    catch (const std::out_of_range&) {
+        caught = true;
+    }
+    assert(caught);
+    heap.push(20);
+    assert(heap.top() == 20);
+
+    // :  
+    heap.clear();
+    caught = false;
+    try {
+        heap.pop();
+    }
+    catch (const std::runtime_error&) {
+        caught = true;
+    }
+    assert(caught);
+
+    // :     Heap  std::greater
+    RadixHeap<long long> radix;
+    Heap<long long, std::greater<long long>> reference;
+    std::mt19937 rng(21);
+    long long current = -1000000;
+    for (int step = 0; step < 50000; ++step) {
+        if (reference.empty() || rng() % 3 != 0) {
+            long long value = current + static_cast<long long>(rng() % 100000);
+            radix.push(value);
+            reference.push(value);
+        }
+        else {
+            assert(radix.top() == reference.top());
+            current = radix.top();
+            radix.pop();
+            reference.pop();
+        }
+        assert(radix.size() == reference.size());
+    }
+
+    // :     
+    RadixHeap<unsigned> wide;
+    wide.push(0xFFFFFFFFu);
+    wide.push(0u);
+    wide.push(0x80000000u);
+    assert(wide.top() == 0u);
+    wide.pop();
+    assert(wide.top() == 0x80000000u);
+    wide.pop();
+    assert(wide.top() == 0xFFFFFFFFu);
+}
+
+//       (  )
+template <typename HeapType>
+bool storedInline(const HeapType& heap) {
+    const char* element = reinterpret_cast<const char*>(&heap.top());
+    const char* object = reinterpret_cast<const char*>(&heap);
+    return element >= object && element < object + sizeof(heap);
+}
+
+void testSmallHeap() {
+    // :  N      
+    SmallHeap<int, 8> heap;
+    for (int value : { 4, 9, 1, 7, 3, 8, 2, 6 }) {
+        heap.push(value);
+    }
+    assert(heap.top() == 9 && storedInline(heap));
+
+    // :      
+    std::vector<int> overflow = { 5, 10, 0 };
+    heap.pushRange(overflow.begin(), overflow.end());
+    assert(heap.size() == 11 && heap.top() == 10 && !storedInline(heap));
+    std::vector<int> popped(heap.size());
+    heap.popN(popped.size(), popped.begin());
+    assert(popped == std::vector<int>({ 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 }));
+
+    // :     ,   
+    SmallHeap<int, 4, std::less<int>, 2, InlineOverflow::Strict> strict;
+    for (int value : { 1, 2, 3 }) {
+        strict.push(value);
+    }
+    std::vector<int> extra = { 4, 5 };
+    bool caught = false;
+    try {
+        strict.pushRange(extra.begin(), extra.end());
+    }
+    catch (const std::length_error&) {
+        caught = true;
+    }
+    assert(caught && strict.size() == 3 && strict.top() == 3);
+
+    // :        
+    std::istringstream input("100 200");
+    caught = false;
+    try {
+        strict.pushRange(std::istream_iterator<int>(input), std::istream_iterator<int>());
+    }
+    catch (const std::length_error&) {
+        caught = true;
+    }
+    assert(caught && strict.size() == 3 && strict.top() == 3);
+    strict.push(4);
+    caught = false;
+    try {
+        strict.push(5);
+    }
+    catch (const std::length_error&) {
+        caught = true;
+    }
+    assert(caught && strict.size() == 4 && strict.top() == 4 && storedInline(strict));
+
+    // : ,      
+    SmallHeap<std::string, 4, std::less<std::string>, 4> words;
+    for (const char* word : { "pear", "apple", "quince", "fig", "melon", "kiwi" }) {
+        words.push(word);
+    }
+    SmallHeap<std::string, 4, std::less<std::string>, 4> copy(words);
+    SmallHeap<std::string, 4, std::less<std::string>, 4> few;
+    few.push("zucchini");
+    few.push("banana");
+    SmallHeap<std::string, 4, std::less<std::string>, 4> moved(std::move(few));
+    assert(moved.top() == "zucchini" && storedInline(moved));
+    copy.merge(std::move(moved));
+    assert(copy.size() == 8 && copy.top() == "zucchini");
+    std::vector<std::string> order;
+    copy.popN(copy.size(), std::back_inserter(order));
+    assert(std::is_sorted(order.begin(), order.end(), std::greater<std::string>()));
+    assert(words.size() == 6 && words.top() == "quince");
+    words = SmallHeap<std::string, 4, std::less<std::string>, 4>();
+    assert(words.empty());
+}
+
+void testConcurrentHeap() {
+    const int threadCount = 4;
+    const int perThread = 5000;
+
+    for (ConcurrencyMode mode : { ConcurrencyMode::Relaxed, ConcurrencyMode::Strict }) {
+        ConcurrentHeap<int> queue(mode, 8);
+        assert(queue.empty());
+
+        // :    
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threadCount; ++t) {
+            workers.emplace_back([&queue, t, perThread]() {
+                for (int i = 0; i < perThread; ++i) {
+                    queue.push(t * perThread + i);
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        assert(queue.size() == static_cast<size_t>(threadCount * perThread));
+
+        // :        
+        std::vector<std::vector<int>> popped(threadCount);
+        workers.clear();
+        for (int t = 0; t < threadCount; ++t) {
+            workers.emplace_back([&queue, &popped, t]() {
+                int val;
+                while (queue.tryPop(val)) {
+                    popped[t].push_back(val);
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        std::vector<int> all;
+        for (const auto& part : popped) {
+            all.insert(all.end(), part.begin(), part.end());
+        }
+        std::sort(all.begin(), all.end());
+        assert(all.size() == static_cast<size_t>(threadCount * perThread));
+        for (size_t i = 0; i < all.size(); ++i) {
+            assert(all[i] == static_cast<int>(i));
+        }
+        assert(queue.empty());
+    }
+
+    // :        
+    ConcurrentHeap<int, std::greater<int>> strict(ConcurrencyMode::Strict, 4);
+    for (int val : { 7, 3, 9, 1, 5 }) {
+        strict.push(val);
+    }
+    int val;
+    for (int expected : { 1, 3, 5, 7, 9 }) {
+        assert(strict.tryPop(val) && val == expected);
+    }
+    assert(!strict.tryPop(val));
+
+    // :        
+    //    ,      
+    ConcurrentHeap<int> ordered(ConcurrencyMode::Strict, 8);
+    for (int i = 0; i < threadCount * perThread; ++i) {
+        ordered.push(i);
+    }
+    std::vector<std::vector<int>> streams(threadCount);
+    std::vector<std::thread> consumers;
+    for (int t = 0; t < threadCount; ++t) {
+        consumers.emplace_back([&ordered, &streams, t]() {
+            int value;
+            while (ordered.tryPop(value)) {
+                streams[t].push_back(value);
+            }
+        });
+    }
+    for (auto& consumer : consumers) {
+        consumer.join();
+    }
+    size_t total = 0;
+    for (const auto& stream : streams) {
+        assert(std::is_sorted(stream.rbegin(), stream.rend()));
+        total += stream.size();
+    }
+    assert(total == static_cast<size_t>(threadCount * perThread) && ordered.empty());
+
+    // :   ,     
+    ConcurrentHeap<int> mixed(ConcurrencyMode::Strict, 2);
+    std::atomic<int> poppedCount(0);
+    std::vector<std::thread> mix;
+    for (int t = 0; t < threadCount; ++t) {
+        mix.emplace_back([&mixed, &poppedCount, t, perThread]() {
+            int value;
+            for (int i = 0; i < perThread; ++i) {
+                mixed.push(t * perThread + i);
+                if (i % 2 == 0 && mixed.tryPop(value)) {
+                    ++poppedCount;
+                }
+            }
+        });
+    }
+    for (auto& worker : mix) {
+        worker.join();
+    }
+    assert(mixed.size() + static_cast<size_t>(poppedCount.load()) == static_cast<size_t>(threadCount * perThread));
+}
+
+//  :    opsPerThread  push/pop
+template <typename Push, typename Pop>
+double runConcurrentLoad(unsigned threadCount, size_t opsPerThread, Push push, Pop pop) {
+    std::vector<std::thread> workers;
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned t = 0; t < threadCount; ++t) {
+        workers.emplace_back([=]() {
+            std::minstd_rand rng(t + 1);
+            for (size_t i = 0; i < opsPerThread; ++i) {
+                push(static_cast<int>(rng()));
+                pop();
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return 2.0 * threadCount * opsPerThread / seconds;
+}
+
+void benchConcurrentHeap(size_t opsPerThread) {
+    unsigned maxThreads = std::thread::hardware_concurrency();
+    if (maxThreads == 0) {
+        maxThreads = 1;
+    }
+
+    // 1, 2, 4, ...    ,    maxThreads
+    std::vector<unsigned> threadCounts;
+    for (unsigned threads = 1; threads < maxThreads; threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(maxThreads);
+
+    for (unsigned threads : threadCounts) {
+        //  :     
+        Heap<int> global;
+        std::mutex globalLock;
+        double globalOps = runConcurrentLoad(threads, opsPerThread,
+            [&](int val) { std::lock_guard<std::mutex> lock(globalLock); global.push(val); },
+            [&]() { std::lock_guard<std::mutex> lock(globalLock); if (!global.empty()) global.pop(); });
+
+        ConcurrentHeap<int> relaxed(ConcurrencyMode::Relaxed);
+        double relaxedOps = runConcurrentLoad(threads, opsPerThread,
+            [&](int val) { relaxed.push(val); },
+            [&]() { int val; relaxed.tryPop(val); });
+
+        ConcurrentHeap<int> strict(ConcurrencyMode::Strict);
+        double strictOps = runConcurrentLoad(threads, opsPerThread,
+            [&](int val) { strict.push(val); },
+            [&]() { int val; strict.tryPop(val); });
+
+        std::cout << "Concurrent heap threads=" << threads
+            << ": global mutex " << globalOps / 1e6 << " Mops/s"
+            << ", relaxed " << relaxedOps / 1e6 << " Mops/s"
+            << ", strict " << strictOps / 1e6 << " Mops/s\n";
+    }
+}
+
+template <size_t Arity>
+void benchHeapArity(const std::vector<int>& values) {
+    Heap<int, std::less<int>, Arity> heap;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int val : values) {
+        heap.push(val);
+    }
+    auto pushTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    while (!heap.empty()) {
+        heap.pop();
+    }
+    auto popTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "Heap arity " << Arity << " n=" << values.size()
+        << ": push " << values.size() / pushTime / 1000.0 << " Mops/s"
+        << ", pop " << values.size() / popTime / 1000.0 << " Mops/s\n";
+}
+
+void benchHeapBuild(size_t count) {
+    std::mt19937 rng(42);
+    std::vector<int> values(count);
+    for (int& val : values) {
+        val = static_cast<int>(rng());
+    }
+
+    //  : n  push
+    auto start = std::chrono::steady_clock::now();
+    Heap<int> pushed;
+    for (int val : values) {
+        pushed.push(val);
+    }
+    auto pushTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    //      
+    start = std::chrono::steady_clock::now();
+    Heap<int> built(values);
+    auto buildTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    //      
+    std::vector<int> moved = values;
+    start = std::chrono::steady_clock::now();
+    Heap<int> adopted(std::move(moved));
+    auto adoptTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    assert(pushed.top() == built.top() && built.top() == adopted.top());
+    std::cout << "Heap build n=" << count
+        << ": push " << pushTime << " ms"
+        << ", copy+build " << buildTime << " ms"
+        << ", move+build " << adoptTime << " ms\n";
+}
+
+//  :   ,  
+//    .       
+template <typename Queue>
+long long runEventSimulation(Queue& queue, const std::vector<int>& delays, size_t initial) {
+    for (size_t i = 0; i < initial; ++i) {
+        queue.push(delays[i]);
+    }
+    long long checksum = 0;
+    for (size_t i = initial; i < delays.size(); ++i) {
+        int now = queue.top();
+        queue.pop();
+        checksum += now;
+        queue.push(now + delays[i]);
+    }
+    while (!queue.empty()) {
+        checksum += queue.top();
+        queue.pop();
+    }
+    return checksum;
+}
+
+void benchRadixHeap(size_t events, size_t pending) {
+    std::mt19937 rng(42);
+    std::vector<int> delays(events);
+    for (int& delay : delays) {
+        delay = 1 + static_cast<int>(rng() % 1000);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    Heap<int, std::greater<int>> heap;
+    long long heapSum = runEventSimulation(heap, delays, pending);
+    auto heapTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    RadixHeap<int> radix;
+    long long radixSum = runEventSimulation(radix, delays, pending);
+    auto radixTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    assert(heapSum == radixSum);
+    std::cout << "Event simulation events=" << events << " pending=" << pending
+        << ": Heap<int> " << heapTime << " ms"
+        << ", RadixHeap<int> " << radixTime << " ms\n";
+}
+
+//    : ,   
+template <typename HeapType>
+double runSmallHeaps(const std::vector<int>& values, size_t heapSize, long long& checksum) {
+    auto start = std::chrono::steady_clock::now();
+    for (size_t offset = 0; offset + heapSize <= values.size(); offset += heapSize) {
+        HeapType heap;
+        for (size_t i = offset; i < offset + heapSize; ++i) {
+            heap.push(values[i]);
+        }
+        while (!heap.empty()) {
+            checksum += heap.top();
+            heap.pop();
+        }
+    }
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void benchSmallHeap(size_t heapSize) {
+    std::mt19937 rng(42);
+    std::vector<int> values(4000000 / heapSize * heapSize);
+    for (int& val : values) {
+        val = static_cast<int>(rng() % 1000);
+    }
+    long long vectorSum = 0;
+    long long inlineSum = 0;
+    double vectorTime = runSmallHeaps<Heap<int>>(values, heapSize, vectorSum);
+    double inlineTime = runSmallHeaps<SmallHeap<int, 64>>(values, heapSize, inlineSum);
+    assert(vectorSum == inlineSum);
+    std::cout << "Small heaps size=" << heapSize << " x" << values.size() / heapSize
+        << ": Heap<int> " << vectorTime << " ms"
+        << ", SmallHeap<int, 64> " << inlineTime << " ms\n";
+}
+
 int main() {
     testHeapSort();
     testHeap();
+    testHeapBuild();
+    testHeapSortInPlace();
+    testHeapCompare();
+    testHeapArity();
+    testHeapSimd();
+    testIndexedHeap();
+    testHeapMove();
+    testHeapBatch();
+    testHeapMerge();
+    testTopK();
+    testHeapMembershipIndex();
+    testConcurrentHeap();
+    testMappedHeap();
+    testRadixHeap();
+    testSmallHeap();
     std::cout << "All tests passed!" << std::endl;
+
+    for (size_t count : { 10000u, 100000u, 1000000u }) {
+        benchHeapBuild(count);
+    }
+
+    for (size_t count : { 100000u, 1000000u, 4000000u }) {
+        std::mt19937 rng(42);
+        std::vector<int> values(count);
+        for (int& val : values) {
+            val = static_cast<int>(rng());
+        }
+        benchHeapArity<2>(values);
+        benchHeapArity<4>(values);
+        benchHeapArity<8>(values);
+    }
+
+    benchConcurrentHeap(200000);
+
+    for (size_t pending : { 1000u, 100000u }) {
+        benchRadixHeap(2000000, pending);
+    }
+
+    for (size_t heapSize : { 8u, 32u, 64u }) {
+        benchSmallHeap(heapSize);
+    }
     return 0;
 }
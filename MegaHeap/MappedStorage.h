@@ -0,0 +1,490 @@
+#pragma once
+#include <algorithm> //  std::sort
+#include <cstddef>
+#include <cstdint>
+#include <cstring> //  std::memcpy
+#include <stdexcept> //  std::runtime_error
+#include <string>
+#include <type_traits>
+#include <utility> //  std::swap
+#include "MegaHeap.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+///   MappedStorage
+enum class MappedSyncMode {
+    None,   //      
+    Sync,   // msync      :   ,    
+    Journal //  :    ,    
+};
+
+///        ( Storage  Heap).
+///     (, , ,  ),
+///        .   
+///   :     .
+///   ,   1    -,   CacheAlignedAllocator.
+///     .
+template <typename T, size_t Arity = 2>
+class MappedStorage {
+    static_assert(std::is_trivially_copyable<T>::value, "MappedStorage requires a trivially copyable type.");
+
+public:
+    using value_type = T;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    ///         initialCapacity
+    explicit MappedStorage(const std::string& path, MappedSyncMode mode = MappedSyncMode::None, size_t initialCapacity = 1024)
+        : mode(mode) {
+        openFile(path);
+        std::uint64_t fileSize = currentFileSize();
+        if (fileSize == 0) {
+            resizeFile(bytesFor(initialCapacity == 0 ? 1 : initialCapacity));
+            header()->magic = fileMagic;
+            header()->elementSize = sizeof(T);
+            header()->arity = Arity;
+            header()->size = 0;
+            header()->capacity = initialCapacity == 0 ? 1 : initialCapacity;
+            header()->journalActive = 0;
+            syncAll();
+        }
+        else {
+            mapFile(static_cast<size_t>(fileSize));
+            if (fileSize < sizeof(Header) || header()->magic != fileMagic) {
+                closeFile();
+                throw std::runtime_error("Not a heap storage file!");
+            }
+            if (header()->elementSize != sizeof(T) || header()->arity != Arity) {
+                closeFile();
+                throw std::runtime_error("Heap storage file has a different element size or arity!");
+            }
+            recover();
+        }
+    }
+
+    MappedStorage(const MappedStorage&) = delete;
+    MappedStorage& operator=(const MappedStorage&) = delete;
+
+    ///  
+    MappedStorage(MappedStorage&& other) noexcept {
+        swap(other);
+    }
+
+    ///  
+    MappedStorage& operator=(MappedStorage&& other) noexcept {
+        if (this != &other) {
+            closeFile();
+            swap(other);
+        }
+        return *this;
+    }
+
+    ~MappedStorage() {
+        closeFile();
+    }
+
+    size_t size() const { return static_cast<size_t>(header()->size); }
+    size_t capacity() const { return static_cast<size_t>(header()->capacity); }
+    bool empty() const { return size() == 0; }
+
+    T* data() { return elements(); }
+    const T* data() const { return elements(); }
+    T* begin() { return elements(); }
+    T* end() { return elements() + size(); }
+    T& operator[](size_t i) { return elements()[i]; }
+    const T& operator[](size_t i) const { return elements()[i]; }
+    T& back() { return elements()[size() - 1]; }
+
+    void push_back(const T& value) {
+        if (size() == capacity()) {
+            reserve(2 * capacity());
+        }
+        elements()[size()] = value;
+        ++header()->size;
+    }
+
+    template <typename... Args>
+    void emplace_back(Args&&... args) {
+        push_back(T(std::forward<Args>(args)...));
+    }
+
+    void pop_back() {
+        --header()->size;
+    }
+
+    void clear() {
+        header()->size = 0;
+    }
+
+    ///    newCapacity 
+    void reserve(size_t newCapacity) {
+        if (newCapacity <= capacity()) {
+            return;
+        }
+        resizeFile(bytesFor(newCapacity));
+        header()->capacity = newCapacity;
+    }
+
+    ///  ;     
+    template <typename InputIt>
+    T* insert(T* position, InputIt first, InputIt last) {
+        size_t offset = static_cast<size_t>(position - elements());
+        if (offset != size()) {
+            throw std::out_of_range("MappedStorage supports appending only!");
+        }
+        for (; first != last; ++first) {
+            push_back(*first);
+        }
+        return elements() + offset;
+    }
+
+    void swap(MappedStorage& other) noexcept {
+        std::swap(mode, other.mode);
+        std::swap(view, other.view);
+        std::swap(mappedBytes, other.mappedBytes);
+        std::swap(touchedSlots, other.touchedSlots);
+        std::swap(touchedCount, other.touchedCount);
+        std::swap(slotsKnown, other.slotsKnown);
+#ifdef _WIN32
+        std::swap(file, other.file);
+        std::swap(mapping, other.mapping);
+#else
+        std::swap(file, other.file);
+#endif
+    }
+
+    ///    
+    bool journaling() const {
+        return mode == MappedSyncMode::Journal;
+    }
+
+    ///    ,   (    )
+    bool tracksSlots() const {
+        return mode != MappedSyncMode::None;
+    }
+
+    ///   :  ,  commitUpdate   
+    /// .           
+    /// .    ,   
+    ///    
+    void beginUpdate(const size_t* slots, size_t count) {
+        if (mode == MappedSyncMode::None) {
+            return;
+        }
+        if (count > journalCapacity) {
+            if (mode == MappedSyncMode::Journal) {
+                throw std::length_error("Heap operation touches too many slots for the journal!");
+            }
+            beginUpdate();
+            return;
+        }
+        std::copy(slots, slots + count, touchedSlots);
+        touchedCount = count;
+        slotsKnown = true;
+        if (mode != MappedSyncMode::Journal) {
+            return;
+        }
+        Header* h = header();
+        h->journalSize = h->size;
+        size_t saved = 0;
+        for (size_t i = 0; i < count; ++i) {
+            if (slots[i] < size()) {
+                std::uint64_t index = slots[i];
+                char* entry = journalEntry(saved++);
+                std::memcpy(entry, &index, sizeof(index));
+                std::memcpy(entry + sizeof(index), &elements()[slots[i]], sizeof(T));
+            }
+        }
+        h->journalCount = saved;
+        syncRange(0, dataOffset());
+        h->journalActive = 1;
+        syncRange(0, sizeof(Header));
+    }
+
+    ///  ,   : commitUpdate   .
+    ///             
+    void beginUpdate() {
+        slotsKnown = false;
+    }
+
+    ///   :       
+    ///  ( ,   ),  
+    void commitUpdate() {
+        if (mode == MappedSyncMode::None) {
+            return;
+        }
+        if (slotsKnown) {
+            syncSlots();
+        }
+        else {
+            syncAll();
+        }
+        slotsKnown = false;
+        if (mode == MappedSyncMode::Journal) {
+            header()->journalActive = 0;
+            syncRange(0, sizeof(Header));
+        }
+    }
+
+    ///      
+    void sync() {
+        syncAll();
+    }
+
+private:
+    ///  
+    struct Header {
+        std::uint64_t magic;
+        std::uint64_t elementSize;
+        std::uint64_t arity;
+        std::uint64_t size;
+        std::uint64_t capacity;
+        std::uint64_t journalActive; // 1    ,   
+        std::uint64_t journalSize;   //    
+        std::uint64_t journalCount;  //   
+    };
+
+    static const std::uint64_t fileMagic = 0x5041454841474D48ULL; // "HMGAHEAP"
+    static const size_t journalCapacity = 2 * 64 + 2; //       
+    static const size_t journalEntrySize = sizeof(std::uint64_t) + sizeof(T);
+    static const size_t lineSize = 64;
+
+    MappedSyncMode mode = MappedSyncMode::None;
+    char* view = nullptr;
+    size_t mappedBytes = 0;
+    size_t touchedSlots[journalCapacity] = {}; //   
+    size_t touchedCount = 0;
+    bool slotsKnown = false; // false    
+#ifdef _WIN32
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+#else
+    int file = -1;
+#endif
+
+    Header* header() { return reinterpret_cast<Header*>(view); }
+    const Header* header() const { return reinterpret_cast<const Header*>(view); }
+
+    ///  :  1   -
+    static size_t dataOffset() {
+        size_t journalEnd = sizeof(Header) + journalCapacity * journalEntrySize;
+        return (journalEnd + sizeof(T) + lineSize - 1) / lineSize * lineSize - sizeof(T);
+    }
+
+    static size_t bytesFor(size_t capacity) {
+        return dataOffset() + capacity * sizeof(T);
+    }
+
+    T* elements() { return reinterpret_cast<T*>(view + dataOffset()); }
+    const T* elements() const { return reinterpret_cast<const T*>(view + dataOffset()); }
+
+    char* journalEntry(size_t i) {
+        return view + sizeof(Header) + i * journalEntrySize;
+    }
+
+    ///     
+    void recover() {
+        Header* h = header();
+        if (h->journalActive == 0) {
+            return;
+        }
+        for (size_t i = 0; i < h->journalCount; ++i) {
+            std::uint64_t index;
+            char* entry = journalEntry(i);
+            std::memcpy(&index, entry, sizeof(index));
+            std::memcpy(&elements()[index], entry + sizeof(index), sizeof(T));
+        }
+        h->size = h->journalSize;
+        syncAll();
+        h->journalActive = 0;
+        syncRange(0, sizeof(Header));
+    }
+
+    void syncAll() {
+        syncRange(0, dataOffset() + size() * sizeof(T));
+    }
+
+    ///       ;  
+    ///    .       
+    void syncSlots() {
+        size_t page = pageSize();
+        size_t pages[2 * journalCapacity + 1];
+        size_t count = 0;
+        pages[count++] = 0;
+        for (size_t i = 0; i < touchedCount; ++i) {
+            if (touchedSlots[i] < size()) {
+                size_t offset = dataOffset() + touchedSlots[i] * sizeof(T);
+                pages[count++] = offset / page;
+                pages[count++] = (offset + sizeof(T) - 1) / page; //      
+            }
+        }
+        std::sort(pages, pages + count);
+        for (size_t i = 0; i < count;) {
+            size_t j = i + 1;
+            while (j < count && pages[j] <= pages[j - 1] + 1) {
+                ++j;
+            }
+            size_t begin = pages[i] * page;
+            size_t end = std::min((pages[j - 1] + 1) * page, mappedBytes);
+            flushView(begin, end - begin);
+            i = j;
+        }
+        flushFile();
+    }
+
+    void syncRange(size_t offset, size_t bytes) {
+        if (view != nullptr && bytes != 0) {
+            flushView(offset, bytes);
+            flushFile();
+        }
+    }
+
+#ifdef _WIN32
+    void openFile(const std::string& path) {
+        file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("Cannot open heap storage file: " + path);
+        }
+    }
+
+    std::uint64_t currentFileSize() const {
+        LARGE_INTEGER size;
+        GetFileSizeEx(file, &size);
+        return static_cast<std::uint64_t>(size.QuadPart);
+    }
+
+    void mapFile(size_t bytes) {
+        LARGE_INTEGER size;
+        size.QuadPart = static_cast<LONGLONG>(bytes);
+        mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, size.HighPart, size.LowPart, nullptr);
+        if (mapping == nullptr) {
+            throw std::runtime_error("Cannot map heap storage file!");
+        }
+        view = static_cast<char*>(MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, bytes));
+        if (view == nullptr) {
+            throw std::runtime_error("Cannot map heap storage file!");
+        }
+        mappedBytes = bytes;
+    }
+
+    void unmapFile() {
+        if (view != nullptr) {
+            UnmapViewOfFile(view);
+            view = nullptr;
+        }
+        if (mapping != nullptr) {
+            CloseHandle(mapping);
+            mapping = nullptr;
+        }
+        mappedBytes = 0;
+    }
+
+    void resizeFile(size_t bytes) {
+        unmapFile();
+        LARGE_INTEGER size;
+        size.QuadPart = static_cast<LONGLONG>(bytes);
+        if (!SetFilePointerEx(file, size, nullptr, FILE_BEGIN) || !SetEndOfFile(file)) {
+            throw std::runtime_error("Cannot resize heap storage file!");
+        }
+        mapFile(bytes);
+    }
+
+    static size_t pageSize() {
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        return static_cast<size_t>(info.dwPageSize);
+    }
+
+    void flushView(size_t offset, size_t bytes) {
+        FlushViewOfFile(view + offset, bytes);
+    }
+
+    /// FlushViewOfFile     
+    void flushFile() {
+        FlushFileBuffers(file);
+    }
+
+    void closeFile() {
+        unmapFile();
+        if (file != INVALID_HANDLE_VALUE) {
+            CloseHandle(file);
+            file = INVALID_HANDLE_VALUE;
+        }
+    }
+#else
+    void openFile(const std::string& path) {
+        file = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+        if (file < 0) {
+            throw std::runtime_error("Cannot open heap storage file: " + path);
+        }
+    }
+
+    std::uint64_t currentFileSize() const {
+        struct stat info;
+        ::fstat(file, &info);
+        return static_cast<std::uint64_t>(info.st_size);
+    }
+
+    void mapFile(size_t bytes) {
+        void* address = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+        if (address == MAP_FAILED) {
+            throw std::runtime_error("Cannot map heap storage file!");
+        }
+        view = static_cast<char*>(address);
+        mappedBytes = bytes;
+    }
+
+    void unmapFile() {
+        if (view != nullptr) {
+            ::munmap(view, mappedBytes);
+            view = nullptr;
+        }
+        mappedBytes = 0;
+    }
+
+    void resizeFile(size_t bytes) {
+        unmapFile();
+        if (::ftruncate(file, static_cast<off_t>(bytes)) != 0) {
+            throw std::runtime_error("Cannot resize heap storage file!");
+        }
+        mapFile(bytes);
+    }
+
+    static size_t pageSize() {
+        return static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    }
+
+    /// msync  ,   
+    void flushView(size_t offset, size_t bytes) {
+        size_t start = offset / pageSize() * pageSize();
+        ::msync(view + start, offset + bytes - start, MS_SYNC);
+    }
+
+    /// msync  MS_SYNC   
+    void flushFile() {}
+
+    void closeFile() {
+        unmapFile();
+        if (file >= 0) {
+            ::close(file);
+            file = -1;
+        }
+    }
+#endif
+};
+
+///   : Heap    
+template <typename T, size_t Arity>
+struct HeapStorageTraits<MappedStorage<T, Arity>> {
+    static const bool transactional = true;
+};
@@ -5,29 +5,156 @@
 #include <algorithm> //  std::reverse
 #include <stdexcept> //  std::runtime_error
 #include <type_traits> //  std::enable_if
+#include <functional> //  std::less, std::greater
+#include <iterator> //  std::iter_swap
+#include <utility> //  std::move
+#include <cstdint> //  std::uintptr_t
+#include <cstring> //  std::memcpy
+#include <new> //  ::operator new
+#include <memory> //  std::allocator
+#include <limits> //  std::numeric_limits
+#ifdef _MSC_VER
+#include <intrin.h> //  _BitScanReverse
+#endif
+#include "HeapSimd.h" //  ChildSelector
+#include "HeapIndex.h" //  MembershipIndex
+
+///    Heap::sortInPlace  Heap::partialSort 
+///   ( std::less     )
+enum class SortOrder {
+    Ascending,  //  :     Compare
+    Descending  //  :    ,   
+};
+
+template <typename Compare>
+struct ReverseOf;
+
+///    d- :    , 
+///    1 (  )    -.
+///   Arity       64- ,
+///  Arity * sizeof(T)  64 (, 4  8 int, 4  8 double).
+template <typename T>
+class CacheAlignedAllocator {
+public:
+    using value_type = T;
+
+    CacheAlignedAllocator() {}
+
+    template <typename U>
+    CacheAlignedAllocator(const CacheAlignedAllocator<U>&) {}
+
+    T* allocate(size_t n) {
+        const size_t lineSize = 64;
+        //          
+        char* raw = static_cast<char*>(::operator new(n * sizeof(T) + lineSize + sizeof(void*)));
+        std::uintptr_t firstChild = reinterpret_cast<std::uintptr_t>(raw) + sizeof(void*) + sizeof(T);
+        firstChild = (firstChild + lineSize - 1) & ~static_cast<std::uintptr_t>(lineSize - 1);
+        char* block = reinterpret_cast<char*>(firstChild - sizeof(T));
+        std::memcpy(block - sizeof(void*), &raw, sizeof(void*));
+        return reinterpret_cast<T*>(block);
+    }
+
+    void deallocate(T* block, size_t) {
+        void* raw;
+        std::memcpy(&raw, reinterpret_cast<char*>(block) - sizeof(void*), sizeof(void*));
+        ::operator delete(raw);
+    }
+
+    template <typename U>
+    bool operator==(const CacheAlignedAllocator<U>&) const { return true; }
+
+    template <typename U>
+    bool operator!=(const CacheAlignedAllocator<U>&) const { return false; }
+};
+
+///  Heap  : std::vector,  Arity > 2     -
+template <typename T, size_t Arity>
+struct HeapVectorStorage {
+    using type = std::vector<T, typename std::conditional<(Arity > 2), CacheAlignedAllocator<T>, std::allocator<T>>::type>;
+};
+
+///  . transactional == true ,  
+///  beginUpdate/commitUpdate/journaling/tracksSlots (, MappedStorage)
+template <typename Storage>
+struct HeapStorageTraits {
+    static const bool transactional = false;
+};
+
+///   Heap:     
+/// (,   MappedStorage),   
+struct HeapOrderedTag {};
 
 ///  Heap   MaxHeap (  )
 ///     ,    .
 ///       ,    
 ///     ( MaxHeap).
-template <typename T>
+///    Compare,   std::priority_queue:
+/// compare(a, b) == true ,  b   . std::less  MaxHeap,
+/// std::greater  MinHeap.      .
+/// Arity    : 4  8     
+/// -  pop   .  Arity > 2  
+///  CacheAlignedAllocator,       -.
+/// Storage       std::vector
+/// (, MappedStorage    ).
+template <typename T, typename Compare = std::less<T>, size_t Arity = 2, typename Storage = typename HeapVectorStorage<T, Arity>::type>
 class Heap {
-    static_assert(std::is_arithmetic<T>::value, "Heap can only be instantiated with arithmetic types.");
+    static_assert(Arity >= 2, "Heap arity must be at least 2.");
+
+    using Transactional = std::integral_constant<bool, HeapStorageTraits<Storage>::transactional>;
 
 public:
-    // ,     
-    Heap(const std::vector<T>& elements) {
-        for (const T& element : elements) {
-            push(element); //    
-        }
+    // ,     .
+    //          (),  O(n)
+    Heap(const std::vector<T>& elements, const Compare& compare = Compare()) : data(elements.begin(), elements.end()), comp(compare) {
+        buildHeap();
+    }
+
+    // ,    ,  O(n).
+    //    (Arity > 2)   
+    Heap(std::vector<T>&& elements, const Compare& compare = Compare())
+        : data(adoptStorage(std::move(elements), std::is_same<Storage, std::vector<T>>())), comp(compare) {
+        buildHeap();
     }
 
     Heap() {}
 
+    // ,  ,    ,  O(1)
+    Heap(HeapOrderedTag, Storage&& storage, const Compare& compare = Compare()) : data(std::move(storage)), comp(compare) {}
+
+    //     
+    explicit Heap(const Compare& compare) : comp(compare) {}
+
+    //  ,      
+    Heap(const Heap& other) : data(other.data), comp(other.comp), index(other.index ? other.index->clone() : nullptr) {}
+
+    //  
+    Heap& operator=(const Heap& other) {
+        if (this != &other) {
+            data = other.data;
+            comp = other.comp;
+            index.reset(other.index ? other.index->clone() : nullptr);
+        }
+        return *this;
+    }
+
+    Heap(Heap&&) = default;
+    Heap& operator=(Heap&&) = default;
+
     ///    ,  O(log n)
     void push(T value) {
-        data.push_back(value); //      
+        emplace(std::move(value));
+    }
+
+    ///  ,     args,  O(log n)
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        journalPath(data.size());
+        data.emplace_back(std::forward<Args>(args)...); //      
+        if (index) {
+            index->add(data.back());
+        }
         heapifyUp(data.size() - 1); //     
+        commitUpdate();
     }
 
     ///   (   MaxHeap),  O(log n)
@@ -35,15 +162,149 @@ public:
         if (data.empty()) {
             throw std::runtime_error("Heap is empty!");
         }
-        data[0] = data.back(); //    
-        data.pop_back(); //   
-        if (!data.empty()) {
-            heapifyDown(0); //     
+        if (index) {
+            index->remove(data[0]);
+        }
+        journalChain(data.size() - 1, data.size() - 1);
+        removeRoot();
+        commitUpdate();
+    }
+
+    ///      ,  O(log n).
+    ///   top() + pop()   
+    T popTop() {
+        if (data.empty()) {
+            throw std::runtime_error("Heap is empty!");
+        }
+        if (index) {
+            index->remove(data[0]);
+        }
+        journalChain(data.size() - 1, data.size() - 1);
+        T result = std::move(data[0]);
+        removeRoot();
+        commitUpdate();
+        return result;
+    }
+
+    ///   [first, last).      ,
+    ///     :   
+    ///    O(k log n)      O(n + k)
+    template <typename InputIt>
+    void pushRange(InputIt first, InputIt last) {
+        if (journaling()) {
+            //       
+            for (; first != last; ++first) {
+                push(*first);
+            }
+            return;
+        }
+        beginUpdate();
+        size_t oldSize = data.size();
+        try {
+            data.insert(data.end(), first, last);
+        }
+        catch (...) {
+            //      
+            // (, InlineStorage   Strict)      
+            while (data.size() > oldSize) {
+                data.pop_back();
+            }
+            throw;
+        }
+        addToIndex(oldSize, data.size());
+        restoreAfterAppend(oldSize);
+        commitUpdate();
+    }
+
+    ///  :   k    out  
+    ///      .     .
+    ///  k   ,       
+    template <typename OutputIt>
+    OutputIt popN(size_t k, OutputIt out) {
+        if (journaling()) {
+            //       
+            for (size_t i = 0; i < k && !data.empty(); ++i) {
+                *out = data[0];
+                ++out;
+                pop();
+            }
+            return out;
         }
+        if (k >= data.size()) {
+            //          
+            heapSortRange(data.data(), data.data() + data.size(), comp);
+            for (size_t i = data.size(); i-- > 0;) {
+                *out = std::move(data[i]);
+                ++out;
+            }
+            clear();
+            return out;
+        }
+
+        beginUpdate();
+        for (size_t i = 0; i < k; ++i) {
+            if (index) {
+                index->remove(data[0]);
+            }
+            *out = std::move(data[0]);
+            ++out;
+            removeRoot();
+        }
+        commitUpdate();
+        return out;
+    }
+
+    ///      O(n + m):  , 
+    ///     pushRange.    .
+    ///      ,  (MappedStorage)
+    ///    
+    void merge(Heap&& other) {
+        if (this == &other) {
+            return;
+        }
+        if (journaling()) {
+            pushRange(other.data.begin(), other.data.end());
+            other.clear();
+            return;
+        }
+        beginUpdate();
+        //       :   
+        //     ,     
+        bool ownsBuffer = !Transactional::value;
+        if (data.empty() && ownsBuffer) {
+            data.swap(other.data); //    
+            addToIndex(0, data.size());
+        }
+        else {
+            bool swapped = ownsBuffer && data.size() < other.data.size();
+            if (swapped) {
+                data.swap(other.data); //     
+            }
+            size_t oldSize = data.size();
+            try {
+                data.insert(data.end(), std::make_move_iterator(other.data.begin()), std::make_move_iterator(other.data.end()));
+            }
+            catch (...) {
+                // , InlineStorage   Strict:      
+                while (data.size() > oldSize) {
+                    data.pop_back();
+                }
+                if (swapped) {
+                    data.swap(other.data);
+                }
+                throw;
+            }
+            //      ;   
+            //   ,    ,    
+            addToIndex(swapped ? 0 : oldSize, swapped ? oldSize : data.size());
+            restoreAfterAppend(oldSize);
+        }
+        other.clear();
+        commitUpdate();
     }
 
-    ///    ( MaxHeap)
-    T top() const {
+    ///    ( MaxHeap)  
+    const T& top() const {
         if (data.empty()) {
             throw std::runtime_error("Heap is empty!");
         }
@@ -61,11 +322,79 @@ public:
     }
 
     void clear() {
+        beginUpdate(nullptr, 0); //   
         data.clear();
+        if (index) {
+            index->clear();
+        }
+        commitUpdate();
+    }
+
+    ///    capacity 
+    void reserve(size_t capacity) {
+        data.reserve(capacity);
+    }
+
+    ///        ,
+    ///   pop + push,  O(log n)
+    void replaceTop(T value) {
+        if (data.empty()) {
+            throw std::runtime_error("Heap is empty!");
+        }
+        if (index) {
+            index->remove(data[0]);
+            index->add(value);
+        }
+        journalChain(data.size(), data.size());
+        siftHole(data.data(), 0, data.size(), comp, std::move(value));
+        commitUpdate();
+    }
+
+    ///   : find  count  O(1)  .
+    ///         ,
+    ///    std::unordered_map ( std::hash<T>).  
+    ///     O(n)     
+    void enableIndex() {
+        index.reset(makeIndex(std::is_arithmetic<T>()));
+        for (const T& element : data) {
+            index->add(element);
+        }
     }
 
-    ///    
+    ///  , find    
+    void disableIndex() {
+        index.reset();
+    }
+
+    ///    
+    bool hasIndex() const {
+        return index != nullptr;
+    }
+
+    ///      (0,   )
+    size_t indexMemoryUsage() const {
+        return index ? index->memoryUsage() : 0;
+    }
+
+    ///    
+    size_t count(const T& value) const {
+        if (index) {
+            return index->count(value);
+        }
+        size_t result = 0;
+        for (const T& element : data) {
+            if (element == value) {
+                ++result;
+            }
+        }
+        return result;
+    }
+
+    ///    : O(1)  ,   
     bool find(const T& value) const {
+        if (index) {
+            return index->count(value) != 0;
+        }
         for (const T& element : data) {
             if (element == value) {
                 return true;
@@ -74,66 +403,926 @@ public:
         return false;
     }
 
-    ///    
+    ///    ,    
     static std::vector<T> sort(const std::vector<T>& d) {
-        Heap heap(d); //     
-        std::vector<T> sorted;
+        std::vector<T> sorted(d); //    
+        sortInPlace(sorted, SortOrder::Descending);
+        return sorted; //   
+    }
 
-        while (!heap.empty()) {
-            sorted.push_back(heap.top()); //   
-            heap.pop(); //    
+    ///    [first, last)      .
+    ///   O(1),  O(n log n)
+    template <typename RandomIt>
+    static void sortInPlace(RandomIt first, RandomIt last, SortOrder order, const Compare& compare = Compare()) {
+        if (order == SortOrder::Ascending) {
+            heapSortRange(first, last, compare);
+        }
+        else {
+            heapSortRange(first, last, ReverseOf<Compare>::make(compare));
+        }
+    }
+
+    ///     .
+    ///   ,     
+    static void sortInPlace(std::vector<T>& buffer, SortOrder order, const Compare& compare = Compare()) {
+        sortInPlace(buffer.data(), buffer.data() + buffer.size(), order, compare);
+    }
+
+    ///  :  [first, middle)   k = middle - first
+    ///     ( Descending  k   Compare),
+    ///  [middle, last)    .
+    ///   O(1),  O(n log k)
+    template <typename RandomIt>
+    static void partialSort(RandomIt first, RandomIt middle, RandomIt last, SortOrder order, const Compare& compare = Compare()) {
+        if (order == SortOrder::Ascending) {
+            partialSortRange(first, middle, last, compare);
+        }
+        else {
+            partialSortRange(first, middle, last, ReverseOf<Compare>::make(compare));
         }
-        return sorted; //   
     }
 
 private:
-    std::vector<T> data; //     
+    Storage data; //     
+    Compare comp; // ,   
+    std::unique_ptr<MembershipIndex<T>> index; //   ( )
 
-    ///     
-    void heapifyUp(int index) {
-        while (index > 0 && data[parent(index)] < data[index]) {
-            std::swap(data[parent(index)], data[index]);
-            index = parent(index);
+    ///     
+    bool journaling() const {
+        return journaling(Transactional());
+    }
+
+    bool journaling(std::false_type) const {
+        return false;
+    }
+
+    bool journaling(std::true_type) const {
+        return data.journaling();
+    }
+
+    ///    ,  
+    bool tracksSlots() const {
+        return tracksSlots(Transactional());
+    }
+
+    bool tracksSlots(std::false_type) const {
+        return false;
+    }
+
+    bool tracksSlots(std::true_type) const {
+        return data.tracksSlots();
+    }
+
+    ///  :     ,
+    ///      
+    void beginUpdate(const size_t* slots, size_t count) {
+        beginUpdate(slots, count, Transactional());
+    }
+
+    void beginUpdate(const size_t*, size_t, std::false_type) {}
+
+    void beginUpdate(const size_t* slots, size_t count, std::true_type) {
+        data.beginUpdate(slots, count);
+    }
+
+    ///   :    
+    void beginUpdate() {
+        beginUpdate(Transactional());
+    }
+
+    void beginUpdate(std::false_type) {}
+
+    void beginUpdate(std::true_type) {
+        data.beginUpdate();
+    }
+
+    ///  :        
+    void commitUpdate() {
+        commitUpdate(Transactional());
+    }
+
+    void commitUpdate(std::false_type) {}
+
+    void commitUpdate(std::true_type) {
+        data.commitUpdate();
+    }
+
+    ///   ,   :        
+    enum : size_t { journalSlots = 8 * sizeof(size_t) + 2 };
+
+    ///  push (     ):      
+    void journalPath(size_t leaf) {
+        if (!tracksSlots()) {
+            return;
+        }
+        size_t slots[journalSlots];
+        size_t count = 0;
+        for (size_t i = leaf;; i = parent(i)) {
+            slots[count++] = i;
+            if (i == 0) {
+                break;
+            }
+        }
+        beginUpdate(slots, count);
+    }
+
+    ///  pop  replaceTop:      
+    ///   ,       .
+    /// extraSlot  ,     
+    void journalChain(size_t size, size_t extraSlot) {
+        if (!tracksSlots()) {
+            return;
+        }
+        size_t slots[journalSlots];
+        size_t count = 0;
+        slots[count++] = extraSlot;
+        for (size_t i = 0;; ) {
+            slots[count++] = i;
+            size_t childIndex = firstChild(i);
+            if (childIndex >= size) {
+                break;
+            }
+            i = selectChild(data.data(), childIndex, size, comp);
+        }
+        beginUpdate(slots, count);
+    }
+
+    ///      data[from, to)
+    void addToIndex(size_t from, size_t to) {
+        if (index) {
+            for (size_t i = from; i < to; ++i) {
+                index->add(data[i]);
+            }
         }
     }
 
+    ///    
+    static MembershipIndex<T>* makeIndex(std::true_type) {
+        return new FlatMembershipIndex<T>();
+    }
+
+    ///    
+    static MembershipIndex<T>* makeIndex(std::false_type) {
+        return new HashMembershipIndex<T>();
+    }
+
+    ///        oldSize:
+    ///       O(k log n)
+    ///      O(n + k),  
+    void restoreAfterAppend(size_t oldSize) {
+        size_t added = data.size() - oldSize;
+        if (added == 0) {
+            return;
+        }
+
+        //    
+        size_t height = 1;
+        for (size_t level = data.size(); level >= Arity; level /= Arity) {
+            ++height;
+        }
+
+        if (added * height > 2 * data.size()) {
+            buildHeap();
+        }
+        else {
+            for (size_t i = oldSize; i < data.size(); ++i) {
+                heapifyUp(i);
+            }
+        }
+    }
+
+    ///    std::vector<T>    
+    static Storage adoptStorage(std::vector<T>&& elements, std::true_type) {
+        return std::move(elements);
+    }
+
+    ///          
+    static Storage adoptStorage(std::vector<T>&& elements, std::false_type) {
+        return Storage(std::make_move_iterator(elements.begin()), std::make_move_iterator(elements.end()));
+    }
+
+    ///       O(n) ( ):
+    ///     ,   
+    void buildHeap() {
+        makeHeapRange(data.data(), data.size(), comp);
+    }
+
+    ///     :  ,
+    ///      ,      
+    void heapifyUp(size_t index) {
+        if (index == 0 || !comp(data[parent(index)], data[index])) {
+            return;
+        }
+        T value = std::move(data[index]);
+        do {
+            data[index] = std::move(data[parent(index)]);
+            index = parent(index);
+        } while (index > 0 && comp(data[parent(index)], value));
+        data[index] = std::move(value);
+    }
+
     ///     
-    void heapifyDown(int index) {
+    void heapifyDown(size_t index) {
+        siftDown(data.data(), index, data.size(), comp);
+    }
+
+    ///  :      
+    /// (       )
+    void removeRoot() {
+        T last = std::move(data.back());
+        data.pop_back();
+        if (!data.empty()) {
+            siftHole(data.data(), 0, data.size(), comp, std::move(last));
+        }
+    }
+
+    ///      size ,   first.
+    /// less(a, b) == true ,  b     ,  a
+    template <typename RandomIt, typename Less>
+    static void siftDown(RandomIt first, size_t index, size_t size, Less less) {
+        if (firstChild(index) < size) {
+            siftHole(first, index, size, less, typename std::iterator_traits<RandomIt>::value_type(std::move(first[index])));
+        }
+    }
+
+    ///  :  index  ,  
+    ///   ,  value    .
+    ///        std::swap
+    template <typename RandomIt, typename Less, typename Value>
+    static void siftHole(RandomIt first, size_t index, size_t size, Less less, Value&& value) {
         while (true) {
-            int maxIndex = index;
-            int leftChildIndex = leftChild(index);
-            int rightChildIndex = rightChild(index);
+            size_t childIndex = firstChild(index);
+            if (childIndex >= size) {
+                break; // 
+            }
+            size_t maxChild = selectChild(first, childIndex, size, less);
+            if (!less(value, first[maxChild])) {
+                break; //  
+            }
+            first[index] = std::move(first[maxChild]);
+            index = maxChild;
+        }
+        first[index] = std::move(value);
+    }
+
+    ///    ,   childIndex (   )
+    template <typename RandomIt, typename Less>
+    static size_t selectChild(RandomIt first, size_t childIndex, size_t size, Less less) {
+        size_t childEnd = childIndex + Arity < size ? childIndex + Arity : size;
+        size_t maxChild = childIndex;
+        for (size_t i = childIndex + 1; i < childEnd; ++i) {
+            if (less(first[maxChild], first[i])) {
+                maxChild = i;
+            }
+        }
+        return maxChild;
+    }
+
+    ///      :    Arity
+    ///   ChildSelector (  int, float, double)
+    template <typename Less>
+    static size_t selectChild(T* first, size_t childIndex, size_t size, Less less) {
+        if (childIndex + Arity <= size) {
+            return childIndex + ChildSelector<T, Less, Arity>::select(first + childIndex, less);
+        }
+        return selectChild<T*, Less>(first, childIndex, size, less);
+    }
+
+    ///     [first, first + size)
+    template <typename RandomIt, typename Less>
+    static void makeHeapRange(RandomIt first, size_t size, Less less) {
+        for (size_t i = size / 2; i-- > 0;) {
+            siftDown(first, i, size, less);
+        }
+    }
+
+    ///  :        
+    template <typename RandomIt, typename Less>
+    static void heapSortRange(RandomIt first, RandomIt last, Less less) {
+        size_t size = static_cast<size_t>(last - first);
+        makeHeapRange(first, size, less);
+        while (size > 1) {
+            --size;
+            typename std::iterator_traits<RandomIt>::value_type last = std::move(first[size]);
+            first[size] = std::move(first[0]);
+            siftHole(first, 0, size, less, std::move(last));
+        }
+    }
+
+    ///  :   k     
+    /// ,    ,   
+    template <typename RandomIt, typename Less>
+    static void partialSortRange(RandomIt first, RandomIt middle, RandomIt last, Less less) {
+        size_t k = static_cast<size_t>(middle - first);
+        if (k == 0) {
+            return;
+        }
+        makeHeapRange(first, k, less);
+        for (RandomIt it = middle; it != last; ++it) {
+            if (less(*it, *first)) {
+                typename std::iterator_traits<RandomIt>::value_type value = std::move(*it);
+                *it = std::move(*first);
+                siftHole(first, 0, k, less, std::move(value));
+            }
+        }
+        heapSortRange(first, middle, less);
+    }
+
+    ///   
+    static size_t parent(size_t index) {
+        return (index - 1) / Arity;
+    }
+
+    ///    ,  Arity - 1  
+    static size_t firstChild(size_t index) {
+        return Arity * index + 1;
+    }
+};
+
+///  :  MaxHeap  MinHeap  
+template <typename Compare>
+struct ReverseCompare {
+    ReverseCompare(const Compare& compare = Compare()) : comp(compare) {}
+
+    template <typename T>
+    bool operator()(const T& a, const T& b) const {
+        return comp(b, a);
+    }
+
+    Compare comp;
+};
+
+///  .  std::less  std::greater   
+/// ,       
+template <typename Compare>
+struct ReverseOf {
+    using type = ReverseCompare<Compare>;
+    static type make(const Compare& compare) { return type(compare); }
+};
+
+template <typename T>
+struct ReverseOf<std::less<T>> {
+    using type = std::greater<T>;
+    static type make(const std::less<T>&) { return type(); }
+};
+
+template <typename T>
+struct ReverseOf<std::greater<T>> {
+    using type = std::less<T>;
+    static type make(const std::greater<T>&) { return type(); }
+};
+
+///   k  ( Compare)   O(k) .
+///     k      ,
+///         .
+///       , O(log k)
+template <typename T, typename Compare = std::less<T>, size_t Arity = 2>
+class TopK {
+public:
+    explicit TopK(size_t k, const Compare& compare = Compare()) : heap(ReverseOf<Compare>::make(compare)), comp(compare), capacity(k) {
+        heap.reserve(k);
+    }
+
+    ///  .  true,     
+    bool offer(const T& value) {
+        if (heap.size() < capacity) {
+            heap.push(value);
+            return true;
+        }
+        if (capacity == 0 || !comp(heap.top(), value)) {
+            return false; //   k- 
+        }
+        heap.replaceTop(value);
+        return true;
+    }
+
+    ///     [first, last)
+    template <typename InputIt>
+    void offerRange(InputIt first, InputIt last) {
+        for (; first != last; ++first) {
+            offer(*first);
+        }
+    }
+
+    ///  :    (k-  )
+    const T& threshold() const {
+        return heap.top();
+    }
+
+    ///          
+    std::vector<T> extract() {
+        std::vector<T> result;
+        result.reserve(heap.size());
+        heap.popN(heap.size(), std::back_inserter(result)); //    
+        std::reverse(result.begin(), result.end());
+        return result;
+    }
+
+    ///   
+    size_t size() const {
+        return heap.size();
+    }
+
+    ///   k
+    size_t getCapacity() const {
+        return capacity;
+    }
+
+    ///  
+    void clear() {
+        heap.clear();
+    }
+
+private:
+    Heap<T, typename ReverseOf<Compare>::type, Arity> heap; //     
+    Compare comp;
+    size_t capacity;
+};
+
+///   (pairing heap)    ,   Heap.
+///          , 
+/// push  merge   O(1),  pop    O(log n).
+///   ,    .
+template <typename T, typename Compare = std::less<T>>
+class PairingHeap {
+public:
+    PairingHeap() {}
+
+    //     
+    explicit PairingHeap(const Compare& compare) : comp(compare) {}
+
+    PairingHeap(const PairingHeap&) = delete;
+    PairingHeap& operator=(const PairingHeap&) = delete;
+
+    ///  
+    PairingHeap(PairingHeap&& other) noexcept : root(other.root), count(other.count), comp(other.comp) {
+        other.root = nullptr;
+        other.count = 0;
+    }
+
+    ///  
+    PairingHeap& operator=(PairingHeap&& other) noexcept {
+        if (this != &other) {
+            clear();
+            root = other.root;
+            count = other.count;
+            comp = other.comp;
+            other.root = nullptr;
+            other.count = 0;
+        }
+        return *this;
+    }
+
+    ~PairingHeap() {
+        clear();
+    }
+
+    ///  ,  O(1)
+    void push(T value) {
+        root = link(root, new Node(std::move(value)));
+        ++count;
+    }
+
+    ///  ,   O(log n)
+    void pop() {
+        if (root == nullptr) {
+            throw std::runtime_error("Heap is empty!");
+        }
+        Node* oldRoot = root;
+        root = mergePairs(root->child);
+        delete oldRoot;
+        --count;
+    }
 
-            if (leftChildIndex < data.size() && data[leftChildIndex] > data[maxIndex]) {
-                maxIndex = leftChildIndex;
+    ///    
+    const T& top() const {
+        if (root == nullptr) {
+            throw std::runtime_error("Heap is empty!");
+        }
+        return root->value;
+    }
+
+    ///      O(1).    
+    void merge(PairingHeap&& other) {
+        if (this == &other) {
+            return;
+        }
+        root = link(root, other.root);
+        count += other.count;
+        other.root = nullptr;
+        other.count = 0;
+    }
+
+    /// ,   
+    bool empty() const {
+        return root == nullptr;
+    }
+
+    ///   
+    size_t size() const {
+        return count;
+    }
+
+    ///   :       
+    void clear() {
+        Node* pending = root;
+        while (pending != nullptr) {
+            Node* node = pending;
+            pending = node->sibling;
+            if (node->child != nullptr) {
+                Node* last = node->child;
+                while (last->sibling != nullptr) {
+                    last = last->sibling;
+                }
+                last->sibling = pending;
+                pending = node->child;
             }
+            delete node;
+        }
+        root = nullptr;
+        count = 0;
+    }
+
+private:
+    /// : ,     
+    struct Node {
+        explicit Node(T&& value) : value(std::move(value)) {}
+
+        T value;
+        Node* child = nullptr;
+        Node* sibling = nullptr;
+    };
+
+    Node* root = nullptr;
+    size_t count = 0;
+    Compare comp; // ,   
+
+    ///   :     
+    Node* link(Node* a, Node* b) {
+        if (a == nullptr) {
+            return b;
+        }
+        if (b == nullptr) {
+            return a;
+        }
+        if (comp(a->value, b->value)) {
+            std::swap(a, b);
+        }
+        b->sibling = a->child;
+        a->child = b;
+        return a;
+    }
 
-            if (rightChildIndex < data.size() && data[rightChildIndex] > data[maxIndex]) {
-                maxIndex = rightChildIndex;
+    ///    :   ,
+    ///     .    . 
+    Node* mergePairs(Node* first) {
+        Node* pairs = nullptr; //     ( sibling)
+        while (first != nullptr) {
+            Node* a = first;
+            Node* b = a->sibling;
+            if (b == nullptr) {
+                a->sibling = pairs;
+                pairs = a;
+                break;
             }
+            first = b->sibling;
+            a->sibling = nullptr;
+            b->sibling = nullptr;
+            Node* merged = link(a, b);
+            merged->sibling = pairs;
+            pairs = merged;
+        }
+
+        Node* result = nullptr;
+        while (pairs != nullptr) {
+            Node* next = pairs->sibling;
+            pairs->sibling = nullptr;
+            result = link(result, pairs);
+            pairs = next;
+        }
+        return result;
+    }
+};
+
+///  - (radix heap)   .
+///  ;       
+///  top() / pop()    Dijkstra   .
+///  i  ,    ,   
+///  ,  i - 1 ( 0  ,  ).
+/// push   O(1), pop    O(log C),  C   :
+///         .
+template <typename T>
+class RadixHeap {
+    static_assert(std::is_integral<T>::value, "RadixHeap requires an integral key.");
+
+    using Key = typename std::make_unsigned<T>::type;
+    static const size_t bits = std::numeric_limits<Key>::digits;
+
+public:
+    RadixHeap() : buckets(bits + 1), last(toKey(std::numeric_limits<T>::min())), count(0) {}
+
+    ///  ,  O(1).      
+    void push(T value) {
+        Key key = toKey(value);
+        if (key < last) {
+            throw std::out_of_range("RadixHeap key is below the last extracted key!");
+        }
+        buckets[bucketOf(key)].push_back(value);
+        ++count;
+    }
 
-            if (index != maxIndex) {
-                std::swap(data[index], data[maxIndex]);
-                index = maxIndex;
+    ///  ,   O(log C)
+    void pop() {
+        if (count == 0) {
+            throw std::runtime_error("Heap is empty!");
+        }
+        refill();
+        buckets[0].pop_back();
+        --count;
+    }
+
+    ///  .      
+    const T& top() const {
+        if (count == 0) {
+            throw std::runtime_error("Heap is empty!");
+        }
+        refill();
+        return buckets[0].back();
+    }
+
+    /// ,   
+    bool empty() const {
+        return count == 0;
+    }
+
+    ///   
+    size_t size() const {
+        return count;
+    }
+
+    ///     ;   
+    void clear() {
+        for (auto& bucket : buckets) {
+            bucket.clear();
+        }
+        last = toKey(std::numeric_limits<T>::min());
+        count = 0;
+    }
+
+private:
+    // top()  ,      const-
+    mutable std::vector<std::vector<T>> buckets;
+    mutable Key last; //   
+    size_t count;
+
+    ///        (  )
+    static Key toKey(T value) {
+        Key key = static_cast<Key>(value);
+        if (std::is_signed<T>::value) {
+            key ^= Key(1) << (bits - 1);
+        }
+        return key;
+    }
+
+    ///   : 0  ,       
+    static size_t bitWidth(std::uint64_t x) {
+        if (x == 0) {
+            return 0;
+        }
+#ifdef _MSC_VER
+        unsigned long index;
+        if (x >> 32) {
+            _BitScanReverse(&index, static_cast<unsigned long>(x >> 32));
+            return index + 33;
+        }
+        _BitScanReverse(&index, static_cast<unsigned long>(x));
+        return index + 1;
+#else
+        return 64 - static_cast<size_t>(__builtin_clzll(x));
+#endif
+    }
+
+    size_t bucketOf(Key key) const {
+        return bitWidth(static_cast<std::uint64_t>(key ^ last));
+    }
+
+    ///   0 ,     
+    ///  ,       
+    void refill() const {
+        if (!buckets[0].empty()) {
+            return;
+        }
+        size_t i = 1;
+        while (buckets[i].empty()) {
+            ++i;
+        }
+        std::vector<T>& source = buckets[i];
+        Key minimum = toKey(source[0]);
+        for (T value : source) {
+            minimum = std::min(minimum, toKey(value));
+        }
+        last = minimum;
+        for (T value : source) {
+            buckets[bucketOf(toKey(value))].push_back(value);
+        }
+        source.clear(); //     
+    }
+};
+
+///  : push   ,  
+///    (update)   (erase)  O(log n).
+///       :  ->   data.
+///    .
+template <typename T, typename Compare = std::less<T>, size_t Arity = 2>
+class IndexedHeap {
+    static_assert(Arity >= 2, "Heap arity must be at least 2.");
+
+public:
+    using Handle = size_t;
+
+    IndexedHeap() {}
+
+    //     
+    explicit IndexedHeap(const Compare& compare) : comp(compare) {}
+
+    ///  ,  ,  O(log n)
+    Handle push(T value) {
+        Handle handle;
+        if (freeHandles.empty()) {
+            handle = positions.size();
+            positions.push_back(data.size());
+        }
+        else {
+            handle = freeHandles.back();
+            freeHandles.pop_back();
+            positions[handle] = data.size();
+        }
+        data.push_back(std::move(value));
+        handles.push_back(handle);
+        heapifyUp(data.size() - 1);
+        return handle;
+    }
+
+    ///  ,  O(log n)
+    void pop() {
+        if (data.empty()) {
+            throw std::runtime_error("Heap is empty!");
+        }
+        removeAt(0);
+    }
+
+    ///    
+    const T& top() const {
+        if (data.empty()) {
+            throw std::runtime_error("Heap is empty!");
+        }
+        return data[0];
+    }
+
+    ///  
+    Handle topHandle() const {
+        if (data.empty()) {
+            throw std::runtime_error("Heap is empty!");
+        }
+        return handles[0];
+    }
+
+    ///       
+    bool contains(Handle handle) const {
+        return handle < positions.size() && positions[handle] != npos;
+    }
+
+    ///   
+    const T& get(Handle handle) const {
+        return data[positionOf(handle)];
+    }
+
+    ///   ( ,   ),  O(log n)
+    void update(Handle handle, T value) {
+        size_t index = positionOf(handle);
+        bool raised = comp(data[index], value);
+        data[index] = std::move(value);
+        if (raised) {
+            heapifyUp(index);
+        }
+        else {
+            heapifyDown(index);
+        }
+    }
+
+    ///   ,  O(log n)
+    void erase(Handle handle) {
+        removeAt(positionOf(handle));
+    }
+
+    /// ,   
+    bool empty() const {
+        return data.empty();
+    }
+
+    ///   
+    size_t size() const {
+        return data.size();
+    }
+
+    /// ,     
+    void clear() {
+        data.clear();
+        handles.clear();
+        positions.clear();
+        freeHandles.clear();
+    }
+
+private:
+    enum : size_t { npos = static_cast<size_t>(-1) }; //   
+
+    std::vector<T> data; //  
+    std::vector<Handle> handles; //   data -> 
+    std::vector<size_t> positions; //  ->   data
+    std::vector<Handle> freeHandles; //  
+    Compare comp; // ,   
+
+    ///      
+    size_t positionOf(Handle handle) const {
+        if (!contains(handle)) {
+            throw std::out_of_range("Invalid heap handle!");
+        }
+        return positions[handle];
+    }
+
+    ///    :     
+    void removeAt(size_t index) {
+        positions[handles[index]] = npos;
+        freeHandles.push_back(handles[index]);
+
+        size_t last = data.size() - 1;
+        if (index != last) {
+            data[index] = std::move(data[last]);
+            handles[index] = handles[last];
+            positions[handles[index]] = index;
+        }
+        data.pop_back();
+        handles.pop_back();
+
+        if (index < data.size()) {
+            //        
+            if (index > 0 && comp(data[parent(index)], data[index])) {
+                heapifyUp(index);
             }
             else {
-                break;  //  ,   
+                heapifyDown(index);
             }
         }
     }
 
-    ///   
-    int parent(int index) const {
-        return (index - 1) / 2;
+    ///       
+    void swapNodes(size_t a, size_t b) {
+        std::swap(data[a], data[b]);
+        std::swap(handles[a], handles[b]);
+        positions[handles[a]] = a;
+        positions[handles[b]] = b;
+    }
+
+    ///     
+    void heapifyUp(size_t index) {
+        while (index > 0 && comp(data[parent(index)], data[index])) {
+            swapNodes(parent(index), index);
+            index = parent(index);
+        }
     }
 
-    ///    
-    int leftChild(int index) const {
-        return 2 * index + 1;
+    ///     
+    void heapifyDown(size_t index) {
+        while (true) {
+            size_t childIndex = firstChild(index);
+            if (childIndex >= data.size()) {
+                break; // 
+            }
+            size_t childEnd = childIndex + Arity < data.size() ? childIndex + Arity : data.size();
+            size_t maxChild = childIndex;
+            for (size_t i = childIndex + 1; i < childEnd; ++i) {
+                if (comp(data[maxChild], data[i])) {
+                    maxChild = i;
+                }
+            }
+
+            if (comp(data[index], data[maxChild])) {
+                swapNodes(index, maxChild);
+                index = maxChild;
+            }
+            else {
+                break;  //  ,   
+            }
+        }
+    }
+
+    ///   
+    static size_t parent(size_t index) {
+        return (index - 1) / Arity;
     }
 
-    ///    
-    int rightChild(int index) const {
-        return 2 * index + 2;
+    ///    
+    static size_t firstChild(size_t index) {
+        return Arity * index + 1;
     }
 };
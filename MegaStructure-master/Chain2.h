@@ -2,6 +2,16 @@
 #include <iostream>
 #include <sstream>
 #include <vector>
+#include <algorithm> //  std::fill
+#include <cstdint>
+#include <cstring> //  std::memcpy
+#include <functional> //  std::less
+#include <iterator> //  std::iterator_traits, std::distance
+#include <memory> //  std::shared_ptr
+#include <new> //  placement new
+#include <stdexcept> //  std::out_of_range, std::invalid_argument
+#include <thread>
+#include <type_traits> //  std::aligned_storage
 //#include "Interface.h"
 
 /// <summary>
@@ -11,98 +21,1348 @@
 template <typename TYPE>
 class Link
 {
+public:
+    /// <summary>
+    ///   :    - 
+    ///         
+    /// </summary>
+    struct Level {
+        Link<TYPE>* next = nullptr;
+        Link<TYPE>* prev = nullptr;
+        size_t width = 0;
+    };
+
 private:
     TYPE data;
     Link<TYPE>* next;
     Link<TYPE>* prev;
-    size_t index = 0;
+    Level* levels = nullptr; //  : levels[0].width  , levels[1..-1]  .     
+
+public:
+    Link(TYPE value) : data(value), next(nullptr), prev(nullptr) {}
+
+    Link(const Link&) = delete;
+    Link& operator=(const Link&) = delete;
+
+    void setData(TYPE value) /*override*/
+    {
+        this->data = value;
+    }
+
+    TYPE getData() const /*override*/
+    {
+        return this->data;
+    }
+
+    /// <summary>
+    ///      (   )
+    /// </summary>
+    /// <returns>    </returns>
+    TYPE& getDataRef() { return this->data; }
+
+    std::string toString() /*override*/
+    {
+        std::stringstream ss;
+        ss << data;
+        return ss.str();
+    }
+
+    /// <summary>
+    ///     
+    /// </summary>
+    /// <returns>    </returns>
+    Link<TYPE>* getNext() { return this->next; }
+
+    /// <summary>
+    ///     
+    /// </summary>
+    /// <returns>    </returns>
+    Link<TYPE>* getPrev() { return this->prev; }
+
+    /// <summary>
+    ///     
+    /// </summary>
+    /// <param name="next">    </param>
+    void setNext(Link<TYPE>* next) { this->next = next; }
+
+    /// <summary>
+    ///     
+    /// </summary>
+    /// <param name="prev">    </param>
+    void setPrev(Link<TYPE>* prev) { this->prev = prev; }
+
+    /// <summary>
+    ///      (1       )
+    /// </summary>
+    /// <returns>  </returns>
+    size_t getHeight() const { return levels != nullptr ? levels[0].width : 1; }
+
+    /// <summary>
+    ///   (nullptr    1)
+    /// </summary>
+    /// <returns>    </returns>
+    Level* getTower() { return levels; }
+
+    /// <summary>
+    ///   ,    
+    /// </summary>
+    /// <param name="tower">   nullptr </param>
+    void setTower(Level* tower) { levels = tower; }
+
+    /// <summary>
+    ///   
+    /// </summary>
+    /// <param name="level">   1   - 1 </param>
+    /// <returns>    </returns>
+    Level& getLevel(size_t level) { return levels[level]; }
+};
+
+/// <summary>
+///   :     ,   ,
+///      .     
+///  ;  float/double        
+/// </summary>
+/// <typeparam name="TYPE">    float/double </typeparam>
+template <typename TYPE, typename Enable = void>
+struct RadixKey;
+
+template <typename TYPE>
+struct RadixKey<TYPE, typename std::enable_if<std::is_integral<TYPE>::value && !std::is_same<TYPE, bool>::value>::type> {
+    typedef typename std::make_unsigned<TYPE>::type type;
+
+    static type get(TYPE value) {
+        type key = static_cast<type>(value);
+        if (std::is_signed<TYPE>::value) {
+            key ^= static_cast<type>(type(1) << (8 * sizeof(type) - 1));
+        }
+        return key;
+    }
+};
+
+template <typename TYPE>
+struct RadixKey<TYPE, typename std::enable_if<std::is_floating_point<TYPE>::value && (sizeof(TYPE) == 4 || sizeof(TYPE) == 8)>::type> {
+    typedef typename std::conditional<sizeof(TYPE) == 4, std::uint32_t, std::uint64_t>::type type;
+
+    static type get(TYPE value) {
+        type bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        const type sign = type(1) << (8 * sizeof(type) - 1);
+        return (bits & sign) != 0 ? static_cast<type>(~bits) : static_cast<type>(bits | sign);
+    }
+};
+
+/// <summary>
+///     :     new/delete
+/// </summary>
+/// <typeparam name="TYPE"></typeparam>
+template <typename TYPE>
+class LinkAllocator
+{
+public:
+    Link<TYPE>* create(const TYPE& value) { return new Link<TYPE>(value); }
+
+    void destroy(Link<TYPE>* link) {
+        destroyTower(link->getTower());
+        delete link;
+    }
+
+    /// <summary>
+    ///    height ( 1)   new[],   
+    /// </summary>
+    typename Link<TYPE>::Level* createTower(size_t height) {
+        typename Link<TYPE>::Level* tower = new typename Link<TYPE>::Level[height];
+        tower[0].width = height;
+        return tower;
+    }
+
+    void destroyTower(typename Link<TYPE>::Level* tower) { delete[] tower; }
+
+    /// <summary>
+    ///    count  .      new,
+    ///      ,    
+    /// </summary>
+    void reserve(size_t) {}
+
+    /// <summary>
+    ///    ( new/delete  )
+    /// </summary>
+    void release() {}
+
+    bool operator==(const LinkAllocator&) const { return true; }
+    bool operator!=(const LinkAllocator&) const { return false; }
+};
+
+/// <summary>
+///  :    (slab)  slabSize ,
+///        .
+///     slabSize ,   .
+///           .
+///  
+/// </summary>
+/// <typeparam name="TYPE"></typeparam>
+template <typename TYPE>
+class LinkPool
+{
+private:
+    ///  :  ,      
+    union Slot {
+        Slot* next;
+        typename std::aligned_storage<sizeof(Link<TYPE>), alignof(Link<TYPE>)>::type storage;
+    };
+
+    using Level = typename Link<TYPE>::Level;
+
+    ///  :           
+    struct FreeTower {
+        Level* next;
+    };
+
+    enum { maxTowerHeight = 32 };
+
+    std::vector<Slot*> slabs;
+    Slot* free_list = nullptr;
+    size_t slab_size;
+    size_t live = 0;
+    size_t free_count = 0;
+
+    std::vector<Level*> tower_slabs;
+    Level* free_towers[maxTowerHeight + 1] = {}; //     
+    Level* tower_cursor = nullptr; //     
+    size_t tower_left = 0;
+
+    /// <summary>
+    ///    count :       
+    /// </summary>
+    void grow(size_t count) {
+        slabs.reserve(slabs.size() + 1);
+        Slot* slab = static_cast<Slot*>(::operator new(count * sizeof(Slot)));
+        slabs.push_back(slab);
+        for (size_t i = count; i-- > 0;) {
+            slab[i].next = free_list;
+            free_list = &slab[i];
+        }
+        free_count += count;
+    }
+
+public:
+    /// <summary>
+    ///     slabSize 
+    /// </summary>
+    explicit LinkPool(size_t slabSize = 1024) : slab_size(slabSize == 0 ? 1 : slabSize) {}
+
+    LinkPool(const LinkPool&) = delete;
+    LinkPool& operator=(const LinkPool&) = delete;
+
+    ~LinkPool() {
+        for (Slot* slab : slabs) {
+            ::operator delete(slab);
+        }
+        for (Level* slab : tower_slabs) {
+            ::operator delete(slab);
+        }
+    }
+
+    /// <summary>
+    ///     
+    /// </summary>
+    /// <param name="value">  </param>
+    /// <returns>  </returns>
+    Link<TYPE>* create(const TYPE& value) {
+        if (free_list == nullptr) {
+            grow(slab_size);
+        }
+        Slot* slot = free_list;
+        free_list = slot->next;
+        try {
+            Link<TYPE>* link = new (&slot->storage) Link<TYPE>(value);
+            ++live;
+            --free_count;
+            return link;
+        }
+        catch (...) {
+            slot->next = free_list;
+            free_list = slot;
+            throw;
+        }
+    }
+
+    /// <summary>
+    ///  count  :    ,
+    ///     count     
+    /// </summary>
+    /// <param name="count">   </param>
+    void reserve(size_t count) {
+        if (count > free_count) {
+            size_t missing = count - free_count;
+            grow(missing > slab_size ? missing : slab_size);
+        }
+    }
+
+    /// <summary>
+    ///  ,     
+    /// </summary>
+    /// <param name="link">  </param>
+    void destroy(Link<TYPE>* link) {
+        destroyTower(link->getTower());
+        link->~Link<TYPE>();
+        Slot* slot = reinterpret_cast<Slot*>(link);
+        slot->next = free_list;
+        free_list = slot;
+        --live;
+        ++free_count;
+    }
+
+    /// <summary>
+    ///   ,       
+    /// </summary>
+    void release() {
+        if (live != 0) {
+            return;
+        }
+        for (Slot* slab : slabs) {
+            ::operator delete(slab);
+        }
+        slabs.clear();
+        free_list = nullptr;
+        free_count = 0;
+        for (Level* slab : tower_slabs) {
+            ::operator delete(slab);
+        }
+        tower_slabs.clear();
+        std::fill(free_towers, free_towers + maxTowerHeight + 1, nullptr);
+        tower_cursor = nullptr;
+        tower_left = 0;
+    }
+
+    /// <summary>
+    ///    height ( 2  32):    
+    ///     
+    /// </summary>
+    /// <param name="height">  </param>
+    /// <returns> , levels[0].width == height </returns>
+    Level* createTower(size_t height) {
+        Level* tower = free_towers[height];
+        if (tower != nullptr) {
+            free_towers[height] = reinterpret_cast<FreeTower*>(tower)->next;
+        }
+        else {
+            if (tower_left < height) {
+                size_t count = slab_size > height ? slab_size : height;
+                tower_slabs.reserve(tower_slabs.size() + 1);
+                tower_cursor = static_cast<Level*>(::operator new(count * sizeof(Level)));
+                tower_slabs.push_back(tower_cursor);
+                tower_left = count;
+            }
+            tower = tower_cursor;
+            tower_cursor += height;
+            tower_left -= height;
+        }
+        for (size_t i = 0; i < height; ++i) {
+            new (tower + i) Level();
+        }
+        tower[0].width = height;
+        return tower;
+    }
+
+    /// <summary>
+    ///       
+    /// </summary>
+    /// <param name="tower">   nullptr </param>
+    void destroyTower(Level* tower) {
+        if (tower == nullptr) {
+            return;
+        }
+        size_t height = tower[0].width;
+        new (tower) FreeTower{ free_towers[height] };
+        free_towers[height] = tower;
+    }
+
+    /// <summary>
+    ///     
+    /// </summary>
+    size_t towerSlabCount() const { return tower_slabs.size(); }
+
+    /// <summary>
+    ///   
+    /// </summary>
+    size_t slabCount() const { return slabs.size(); }
+
+    /// <summary>
+    ///       
+    /// </summary>
+    size_t liveCount() const { return live; }
+};
+
+/// <summary>
+///     .     ,
+///         :
+/// Chain2&lt;int, PoolLinkAllocator&lt;int&gt;&gt; a(pool), b(pool);
+/// </summary>
+/// <typeparam name="TYPE"></typeparam>
+template <typename TYPE>
+class PoolLinkAllocator
+{
+private:
+    std::shared_ptr<LinkPool<TYPE>> pool;
+
+public:
+    /// <summary>
+    ///    
+    /// </summary>
+    /// <param name="slabSize">     </param>
+    explicit PoolLinkAllocator(size_t slabSize = 1024) : pool(std::make_shared<LinkPool<TYPE>>(slabSize)) {}
+
+    Link<TYPE>* create(const TYPE& value) { return pool->create(value); }
+    void destroy(Link<TYPE>* link) { pool->destroy(link); }
+
+    /// <summary>
+    ///    count  :      
+    /// </summary>
+    void reserve(size_t count) { pool->reserve(count); }
+
+    typename Link<TYPE>::Level* createTower(size_t height) { return pool->createTower(height); }
+    void destroyTower(typename Link<TYPE>::Level* tower) { pool->destroyTower(tower); }
+
+    /// <summary>
+    ///   ,          
+    /// </summary>
+    void release() { pool->release(); }
+
+    /// <summary>
+    ///   ( )
+    /// </summary>
+    const LinkPool<TYPE>& getPool() const { return *pool; }
+
+    bool operator==(const PoolLinkAllocator& other) const { return pool == other.pool; }
+    bool operator!=(const PoolLinkAllocator& other) const { return pool != other.pool; }
+};
+
+/// <summary>
+///  ()
+/// </summary>
+/// <typeparam name="TYPE"></typeparam>
+/// <typeparam name="Allocator">   : LinkAllocator  PoolLinkAllocator </typeparam>
+template <typename TYPE, typename Allocator = LinkAllocator<TYPE>>
+class Chain2
+{
+private:
+    Allocator allocator;
+    size_t chain_size = 0;
+    Link<TYPE>* current_link = nullptr;
+    Link<TYPE>* first_link = nullptr;
+    Link<TYPE>* last_link = nullptr;
+
+    /// <summary>
+    ///   :      .
+    ///   =  + rank_shift (  2^64),  
+    ///           rank_shift
+    /// </summary>
+    struct Lane {
+        Link<TYPE>* first = nullptr;
+        Link<TYPE>* last = nullptr;
+        size_t first_label = 0;
+        size_t last_label = 0;
+    };
+
+    /// <summary>
+    /// :    
+    /// </summary>
+    struct Finger {
+        Link<TYPE>* link;
+        size_t rank;
+    };
+
+    enum { maxHeight = 32, maxFingers = 8, walkLimit = 8 };
+
+    //     skip list  :   h
+    //    1..h-1,        .
+    //       ,   
+    //  ;  (, , )   
+    std::vector<Lane> lanes; // lanes[0]  
+    bool lanes_valid = false;
+    size_t rank_shift = 0;
+    std::uint32_t random_state = 2463534242u;
+
+    //   current_link ( )     :
+    //        
+    bool current_ranked = false;
+    size_t current_rank = 0;
+    Finger fingers[maxFingers];
+    size_t finger_count = 0;
+    size_t finger_capacity = 0;
+    size_t finger_next = 0;
+
+    size_t rankOf(size_t label) const { return label + rank_shift; }
+    size_t labelOf(size_t rank) const { return rank - rank_shift; }
+
+    /// <summary>
+    ///    :      1/4
+    /// </summary>
+    size_t randomHeight() {
+        size_t height = 1;
+        while (height < maxHeight) {
+            random_state ^= random_state << 13;
+            random_state ^= random_state >> 17;
+            random_state ^= random_state << 5;
+            if ((random_state & 3) != 0) {
+                break;
+            }
+            ++height;
+        }
+        return height;
+    }
+
+    /// <summary>
+    ///   ,       
+    /// </summary>
+    void invalidateIndex() {
+        lanes_valid = false;
+        finger_count = 0;
+        current_ranked = false;
+    }
+
+    /// <summary>
+    ///      rank (chain_size   )
+    /// </summary>
+    void trackInsert(Link<TYPE>* link, size_t rank) {
+        indexInsert(link, rank);
+        for (size_t i = 0; i < finger_count; ++i) {
+            if (fingers[i].rank >= rank) {
+                ++fingers[i].rank;
+            }
+        }
+        if (current_ranked && current_rank >= rank) {
+            ++current_rank;
+        }
+    }
+
+    /// <summary>
+    ///      rank ( , chain_size   ).
+    ///       ,      
+    /// </summary>
+    void trackErase(Link<TYPE>* link, size_t rank) {
+        indexErase(link, rank);
+        size_t kept = 0;
+        for (size_t i = 0; i < finger_count; ++i) {
+            if (fingers[i].link != link) {
+                fingers[kept] = fingers[i];
+                if (fingers[kept].rank > rank) {
+                    --fingers[kept].rank;
+                }
+                ++kept;
+            }
+        }
+        finger_count = kept;
+        finger_next = finger_count < finger_capacity ? finger_count : 0;
+        if (current_link == link) {
+            current_ranked = true;
+            current_rank = rank;
+            current_link = link->getNext();
+            if (current_link == nullptr) {
+                current_link = link->getPrev();
+                current_rank = rank - 1;
+                current_ranked = current_link != nullptr;
+            }
+        }
+        else if (current_ranked && current_rank > rank) {
+            --current_rank;
+        }
+    }
+
+    /// <summary>
+    ///  ; ,    ,    
+    /// </summary>
+    void remember(Link<TYPE>* link, size_t rank, size_t usedFinger) {
+        if (usedFinger < finger_count) {
+            fingers[usedFinger].link = link;
+            fingers[usedFinger].rank = rank;
+            return;
+        }
+        if (finger_capacity == 0) {
+            return;
+        }
+        if (finger_count < finger_capacity) {
+            fingers[finger_count++] = Finger{ link, rank };
+            finger_next = finger_count < finger_capacity ? finger_count : 0;
+            return;
+        }
+        fingers[finger_next] = Finger{ link, rank };
+        finger_next = (finger_next + 1) % finger_capacity;
+    }
+
+    /// <summary>
+    ///    :         
+    /// </summary>
+    void setHeight(Link<TYPE>* link, size_t height) {
+        if (height == link->getHeight()) {
+            return;
+        }
+        typename Link<TYPE>::Level* old = link->getTower();
+        link->setTower(nullptr);
+        allocator.destroyTower(old);
+        if (height > 1) {
+            link->setTower(allocator.createTower(height));
+        }
+    }
+
+    /// <summary>
+    ///     :   
+    /// ( 4-    2,  16-   3  ..)
+    /// </summary>
+    void buildIndex() {
+        lanes.assign(1, Lane());
+        rank_shift = 0;
+        size_t rank = 0;
+        for (Link<TYPE>* link = first_link; link != nullptr; link = link->getNext(), ++rank) {
+            size_t height = 1;
+            for (size_t step = rank + 1; step % 4 == 0 && height < maxHeight; step /= 4) {
+                ++height;
+            }
+            setHeight(link, height);
+            if (lanes.size() < height) {
+                lanes.resize(height);
+            }
+            for (size_t level = 1; level < height; ++level) {
+                appendToLane(link, level, rank);
+            }
+        }
+        lanes_valid = true;
+    }
+
+    /// <summary>
+    ///    
+    /// </summary>
+    void appendToLane(Link<TYPE>* link, size_t level, size_t rank) {
+        Lane& lane = lanes[level];
+        typename Link<TYPE>::Level& entry = link->getLevel(level);
+        entry.next = nullptr;
+        entry.prev = lane.last;
+        if (lane.last != nullptr) {
+            lane.last->getLevel(level).next = link;
+            lane.last->getLevel(level).width = rank - rankOf(lane.last_label);
+        }
+        else {
+            lane.first = link;
+            lane.first_label = labelOf(rank);
+        }
+        lane.last = link;
+        lane.last_label = labelOf(rank);
+    }
+
+    /// <summary>
+    ///     ( 0, rank_shift  )
+    /// </summary>
+    void prependToLane(Link<TYPE>* link, size_t level) {
+        Lane& lane = lanes[level];
+        typename Link<TYPE>::Level& entry = link->getLevel(level);
+        entry.prev = nullptr;
+        entry.next = lane.first;
+        if (lane.first != nullptr) {
+            entry.width = rankOf(lane.first_label);
+            lane.first->getLevel(level).prev = link;
+        }
+        else {
+            lane.last = link;
+            lane.last_label = labelOf(0);
+        }
+        lane.first = link;
+        lane.first_label = labelOf(0);
+    }
+
+    /// <summary>
+    ///   :          rank
+    /// (nullptr,   )   
+    /// </summary>
+    void findPredecessors(size_t rank, Link<TYPE>** update, size_t* updateRank) {
+        Link<TYPE>* node = nullptr;
+        size_t nodeRank = 0;
+        for (size_t level = lanes.size(); level-- > 1;) {
+            Link<TYPE>* next = node != nullptr ? node->getLevel(level).next : lanes[level].first;
+            size_t nextRank = node != nullptr ? nodeRank + node->getLevel(level).width : rankOf(lanes[level].first_label);
+            while (next != nullptr && nextRank < rank) {
+                node = next;
+                nodeRank = nextRank;
+                next = node->getLevel(level).next;
+                nextRank = nodeRank + node->getLevel(level).width;
+            }
+            update[level] = node;
+            updateRank[level] = nodeRank;
+        }
+    }
+
+    /// <summary>
+    ///    ,       rank
+    /// (chain_size   ).    O(1)  ,    O(log n)
+    /// </summary>
+    void indexInsert(Link<TYPE>* link, size_t rank) {
+        if (!lanes_valid) {
+            return;
+        }
+        size_t height = randomHeight();
+        setHeight(link, height);
+        if (lanes.size() < height) {
+            lanes.resize(height);
+        }
+        if (rank == chain_size) {
+            for (size_t level = 1; level < height; ++level) {
+                appendToLane(link, level, rank);
+            }
+            return;
+        }
+        if (rank == 0) {
+            ++rank_shift;
+            for (size_t level = 1; level < height; ++level) {
+                prependToLane(link, level);
+            }
+            return;
+        }
+
+        Link<TYPE>* update[maxHeight];
+        size_t updateRank[maxHeight];
+        findPredecessors(rank, update, updateRank);
+        for (size_t level = 1; level < lanes.size(); ++level) {
+            Lane& lane = lanes[level];
+            Link<TYPE>* pred = update[level];
+            bool lastShifts = lane.last != nullptr && rankOf(lane.last_label) >= rank;
+            if (level < height) {
+                typename Link<TYPE>::Level& entry = link->getLevel(level);
+                Link<TYPE>* succ = pred != nullptr ? pred->getLevel(level).next : lane.first;
+                entry.prev = pred;
+                entry.next = succ;
+                if (succ != nullptr) {
+                    size_t succRank = pred != nullptr ? updateRank[level] + pred->getLevel(level).width : rankOf(lane.first_label);
+                    entry.width = succRank + 1 - rank;
+                    succ->getLevel(level).prev = link;
+                }
+                else {
+                    lane.last = link;
+                    lane.last_label = labelOf(rank);
+                }
+                if (pred != nullptr) {
+                    pred->getLevel(level).next = link;
+                    pred->getLevel(level).width = rank - updateRank[level];
+                }
+                else {
+                    lane.first = link;
+                    lane.first_label = labelOf(rank);
+                }
+            }
+            else if (pred != nullptr) {
+                if (pred->getLevel(level).next != nullptr) {
+                    ++pred->getLevel(level).width;
+                }
+            }
+            else if (lane.first != nullptr) {
+                ++lane.first_label;
+            }
+            if (lastShifts) {
+                ++lane.last_label;
+            }
+        }
+    }
+
+    /// <summary>
+    ///       rank     
+    /// (chain_size   )
+    /// </summary>
+    void indexErase(Link<TYPE>* link, size_t rank) {
+        if (!lanes_valid) {
+            return;
+        }
+        size_t height = link->getHeight();
+        if (rank == 0) {
+            for (size_t level = 1; level < height; ++level) {
+                Lane& lane = lanes[level];
+                typename Link<TYPE>::Level& entry = link->getLevel(level);
+                lane.first = entry.next;
+                if (entry.next != nullptr) {
+                    entry.next->getLevel(level).prev = nullptr;
+                    lane.first_label = entry.width - rank_shift; //  width - 1  rank_shift - 1
+                }
+                else {
+                    lane.last = nullptr;
+                }
+            }
+            --rank_shift;
+            return;
+        }
+        if (rank + 1 == chain_size) {
+            for (size_t level = 1; level < height; ++level) {
+                Lane& lane = lanes[level];
+                typename Link<TYPE>::Level& entry = link->getLevel(level);
+                lane.last = entry.prev;
+                if (entry.prev != nullptr) {
+                    entry.prev->getLevel(level).next = nullptr;
+                    lane.last_label = labelOf(rank - entry.prev->getLevel(level).width);
+                }
+                else {
+                    lane.first = nullptr;
+                }
+            }
+            return;
+        }
+
+        Link<TYPE>* update[maxHeight];
+        size_t updateRank[maxHeight];
+        findPredecessors(rank, update, updateRank);
+        for (size_t level = 1; level < lanes.size(); ++level) {
+            Lane& lane = lanes[level];
+            Link<TYPE>* pred = update[level];
+            bool lastShifts = lane.last != nullptr && lane.last != link && rankOf(lane.last_label) > rank;
+            if (level < height) {
+                typename Link<TYPE>::Level& entry = link->getLevel(level);
+                Link<TYPE>* succ = entry.next;
+                if (pred != nullptr) {
+                    pred->getLevel(level).next = succ;
+                    if (succ != nullptr) {
+                        pred->getLevel(level).width += entry.width - 1;
+                    }
+                }
+                else {
+                    lane.first = succ;
+                    if (succ != nullptr) {
+                        lane.first_label = labelOf(rank + entry.width - 1);
+                    }
+                }
+                if (succ != nullptr) {
+                    succ->getLevel(level).prev = pred;
+                }
+                else {
+                    lane.last = pred;
+                    lane.last_label = labelOf(updateRank[level]);
+                }
+            }
+            else if (pred != nullptr) {
+                if (pred->getLevel(level).next != nullptr) {
+                    --pred->getLevel(level).width;
+                }
+            }
+            else if (lane.first != nullptr) {
+                --lane.first_label;
+            }
+            if (lastShifts) {
+                --lane.last_label;
+            }
+        }
+    }
+
+    /// <summary>
+    ///      size   O(log n)
+    /// </summary>
+    void truncateIndex(size_t size) {
+        Link<TYPE>* update[maxHeight];
+        size_t updateRank[maxHeight];
+        findPredecessors(size, update, updateRank);
+        for (size_t level = 1; level < lanes.size(); ++level) {
+            Lane& lane = lanes[level];
+            lane.last = update[level];
+            if (lane.last != nullptr) {
+                lane.last->getLevel(level).next = nullptr;
+                lane.last_label = labelOf(updateRank[level]);
+            }
+            else {
+                lane.first = nullptr;
+            }
+        }
+    }
+
+    /// <summary>
+    ///   first..last ( [from, to))  .  
+    /// ,   ;    , 
+    ///      
+    /// </summary>
+    void unlinkRange(Link<TYPE>* first, Link<TYPE>* last, size_t from, size_t to) {
+        Link<TYPE>* before = first->getPrev();
+        Link<TYPE>* after = last->getNext();
+        if (before != nullptr) {
+            before->setNext(after);
+        }
+        else {
+            first_link = after;
+        }
+        if (after != nullptr) {
+            after->setPrev(before);
+        }
+        else {
+            last_link = before;
+        }
+        first->setPrev(nullptr);
+        last->setNext(nullptr);
 
-public:
-    Link(TYPE value) : data(value), next(nullptr), prev(nullptr) {}
+        size_t count = to - from;
+        if (lanes_valid) {
+            if (to == chain_size) {
+                truncateIndex(from);
+            }
+            else {
+                lanes_valid = false;
+            }
+        }
+        size_t kept = 0;
+        for (size_t i = 0; i < finger_count; ++i) {
+            if (fingers[i].rank < from || fingers[i].rank >= to) {
+                fingers[kept] = fingers[i];
+                if (fingers[kept].rank >= to) {
+                    fingers[kept].rank -= count;
+                }
+                ++kept;
+            }
+        }
+        finger_count = kept;
+        finger_next = finger_count < finger_capacity ? finger_count : 0;
+        if (!current_ranked) {
+            //         
+            current_link = first_link;
+            current_rank = 0;
+            current_ranked = current_link != nullptr;
+        }
+        else if (current_rank >= to) {
+            current_rank -= count;
+        }
+        else if (current_rank >= from) {
+            current_link = after != nullptr ? after : before;
+            current_rank = after != nullptr ? from : from - 1;
+            current_ranked = current_link != nullptr;
+        }
+        chain_size -= count;
+    }
 
-    void setData(TYPE value) /*override*/
-    {
-        this->data = value;
+    /// <summary>
+    ///    first..last (count )   index.
+    ///           ,
+    ///      ,     
+    /// </summary>
+    void linkRange(Link<TYPE>* first, Link<TYPE>* last, size_t index, size_t count) {
+        Link<TYPE>* after = index < chain_size ? linkAt(index, false) : nullptr;
+        Link<TYPE>* before = after != nullptr ? after->getPrev() : last_link;
+        first->setPrev(before);
+        last->setNext(after);
+        if (before != nullptr) {
+            before->setNext(first);
+        }
+        else {
+            first_link = first;
+        }
+        if (after != nullptr) {
+            after->setPrev(last);
+        }
+        else {
+            last_link = last;
+        }
+
+        if (lanes_valid && (index == 0 || index == chain_size) && count <= chain_size) {
+            if (index == 0) {
+                for (Link<TYPE>* link = last; link != before; link = link->getPrev()) {
+                    trackInsert(link, 0);
+                    ++chain_size;
+                }
+            }
+            else {
+                for (Link<TYPE>* link = first; link != after; link = link->getNext()) {
+                    trackInsert(link, chain_size);
+                    ++chain_size;
+                }
+            }
+        }
+        else {
+            lanes_valid = false;
+            for (size_t i = 0; i < finger_count; ++i) {
+                if (fingers[i].rank >= index) {
+                    fingers[i].rank += count;
+                }
+            }
+            if (current_ranked && current_rank >= index) {
+                current_rank += count;
+            }
+            chain_size += count;
+        }
+        if (current_link == nullptr) {
+            current_link = first_link;
+            current_rank = 0;
+            current_ranked = true;
+        }
     }
 
-    TYPE getData() const /*override*/
-    {
-        return this->data;
+    /// <summary>
+    ///    count ,   produce:   
+    ///     ,      
+    ///  ;       
+    /// </summary>
+    template <typename Produce>
+    void appendRun(size_t count, Produce produce) {
+        if (count == 0) {
+            return;
+        }
+        allocator.reserve(count);
+        Link<TYPE>* first = allocator.create(produce());
+        Link<TYPE>* last = first;
+        try {
+            for (size_t i = 1; i < count; ++i) {
+                Link<TYPE>* link = allocator.create(produce());
+                link->setPrev(last);
+                last->setNext(link);
+                last = link;
+            }
+        }
+        catch (...) {
+            while (first != nullptr) {
+                Link<TYPE>* next = first->getNext();
+                allocator.destroy(first);
+                first = next;
+            }
+            throw;
+        }
+        linkRange(first, last, chain_size, count);
     }
 
-    std::string toString() /*override*/
-    {
-        std::stringstream ss;
-        ss << data;
-        return ss.str();
+    /// <summary>
+    ///      
+    /// </summary>
+    void appendCopy(const Chain2& other) {
+        Link<TYPE>* link = other.first_link;
+        appendRun(other.chain_size, [&link]() {
+            TYPE value = link->getData();
+            link = link->getNext();
+            return value;
+        });
     }
 
     /// <summary>
-    ///     
+    ///     [from, to)
     /// </summary>
-    /// <returns>    </returns>
-    Link<TYPE>* getNext() { return this->next; }
+    void destroyRange(size_t from, size_t to) {
+        Link<TYPE>* first = linkAt(from, false);
+        Link<TYPE>* last = first;
+        for (size_t i = from + 1; i < to; ++i) {
+            last = last->getNext();
+        }
+        unlinkRange(first, last, from, to);
+        while (first != nullptr) {
+            Link<TYPE>* next = first->getNext();
+            allocator.destroy(first);
+            first = next;
+        }
+        if (chain_size == 0) {
+            allocator.release();
+        }
+    }
 
     /// <summary>
-    ///     
+    ///   :     O(log n),     
     /// </summary>
-    /// <returns>    </returns>
-    Link<TYPE>* getPrev() { return this->prev; }
+    Link<TYPE>* indexLookup(size_t index) {
+        if (!lanes_valid) {
+            buildIndex();
+        }
+        Link<TYPE>* node = nullptr;
+        size_t nodeRank = 0;
+        for (size_t level = lanes.size(); level-- > 1;) {
+            Link<TYPE>* next = node != nullptr ? node->getLevel(level).next : lanes[level].first;
+            size_t nextRank = node != nullptr ? nodeRank + node->getLevel(level).width : rankOf(lanes[level].first_label);
+            while (next != nullptr && nextRank <= index) {
+                node = next;
+                nodeRank = nextRank;
+                next = node->getLevel(level).next;
+                nextRank = nodeRank + node->getLevel(level).width;
+            }
+        }
+        if (node == nullptr) {
+            node = first_link;
+            nodeRank = 0;
+        }
+        for (; nodeRank < index; ++nodeRank) {
+            node = node->getNext();
+        }
+        return node;
+    }
 
     /// <summary>
-    ///     
+    ///   .        , ,
+    ///   ;     walkLimit ,     .
+    ///  allowBuild  ,     ( ,
+    ///     )
     /// </summary>
-    /// <param name="next">    </param>
-    void setNext(Link<TYPE>* next) { this->next = next; }
+    Link<TYPE>* linkAt(size_t index, bool allowBuild = true) {
+        Link<TYPE>* anchor = first_link;
+        size_t anchorRank = 0;
+        size_t distance = index;
+        size_t usedFinger = maxFingers;
+        if (chain_size - 1 - index < distance) {
+            anchor = last_link;
+            anchorRank = chain_size - 1;
+            distance = chain_size - 1 - index;
+        }
+        if (current_ranked) {
+            size_t gap = current_rank > index ? current_rank - index : index - current_rank;
+            if (gap < distance) {
+                anchor = current_link;
+                anchorRank = current_rank;
+                distance = gap;
+            }
+        }
+        for (size_t i = 0; i < finger_count; ++i) {
+            size_t gap = fingers[i].rank > index ? fingers[i].rank - index : index - fingers[i].rank;
+            if (gap < distance) {
+                anchor = fingers[i].link;
+                anchorRank = fingers[i].rank;
+                distance = gap;
+                usedFinger = i;
+            }
+        }
+
+        Link<TYPE>* link = anchor;
+        if (distance > walkLimit && (lanes_valid || allowBuild)) {
+            link = indexLookup(index);
+        }
+        else {
+            for (; anchorRank < index; ++anchorRank) {
+                link = link->getNext();
+            }
+            for (; anchorRank > index; --anchorRank) {
+                link = link->getPrev();
+            }
+        }
+        remember(link, index, usedFinger);
+        return link;
+    }
 
     /// <summary>
-    ///     
+    ///       rest (  next):
+    ///         
     /// </summary>
-    /// <param name="prev">    </param>
-    void setPrev(Link<TYPE>* prev) { this->prev = prev; }
+    /// <returns>  ; rest    </returns>
+    template <typename Compare>
+    static Link<TYPE>* takeRun(Link<TYPE>*& rest, Compare& less) {
+        Link<TYPE>* head = rest;
+        Link<TYPE>* tail = head;
+        Link<TYPE>* next = head->getNext();
+        if (next != nullptr && less(next->getDataRef(), head->getDataRef())) {
+            head->setNext(nullptr);
+            while (next != nullptr && less(next->getDataRef(), tail->getDataRef())) {
+                tail = next;
+                next = next->getNext();
+                tail->setNext(head);
+                head = tail;
+            }
+            rest = next;
+            return head;
+        }
+        while (next != nullptr && !less(next->getDataRef(), tail->getDataRef())) {
+            tail = next;
+            next = next->getNext();
+        }
+        tail->setNext(nullptr);
+        rest = next;
+        return head;
+    }
 
     /// <summary>
-    ///   
+    ///       next;
+    ///       left
     /// </summary>
-    /// <returns>   </returns>
-    size_t getIndex() { return index; }
+    template <typename Compare>
+    static Link<TYPE>* mergeRuns(Link<TYPE>* left, Link<TYPE>* right, Compare& less) {
+        Link<TYPE>* head = nullptr;
+        Link<TYPE>* tail = nullptr;
+        while (left != nullptr && right != nullptr) {
+            Link<TYPE>* taken;
+            if (less(right->getDataRef(), left->getDataRef())) {
+                taken = right;
+                right = right->getNext();
+            }
+            else {
+                taken = left;
+                left = left->getNext();
+            }
+            if (tail != nullptr) {
+                tail->setNext(taken);
+            }
+            else {
+                head = taken;
+            }
+            tail = taken;
+        }
+        Link<TYPE>* remaining = left != nullptr ? left : right;
+        if (tail != nullptr) {
+            tail->setNext(remaining);
+        }
+        else {
+            head = remaining;
+        }
+        return head;
+    }
 
     /// <summary>
-    ///   
+    ///     (  next)      prev
     /// </summary>
-    /// <param name="index">   size_t </param>
-    void setIndex(size_t index) { this->index = index; }
-};
+    void adoptRuns(Link<TYPE>* const* runs, size_t count, size_t total) {
+        first_link = nullptr;
+        Link<TYPE>* prev = nullptr;
+        for (size_t i = 0; i < count; ++i) {
+            for (Link<TYPE>* ptr = runs[i]; ptr != nullptr; ptr = ptr->getNext()) {
+                ptr->setPrev(prev);
+                if (prev == nullptr) {
+                    first_link = ptr;
+                }
+                else {
+                    prev->setNext(ptr);
+                }
+                prev = ptr;
+            }
+        }
+        last_link = prev;
+        chain_size = total;
+    }
 
-/// <summary>
-///  ()
-/// </summary>
-/// <typeparam name="TYPE"></typeparam>
-template <typename TYPE>
-class Chain2
-{
-private:
-    size_t chain_size = 0;
-    Link<TYPE>* current_link = nullptr;
-    Link<TYPE>* first_link = nullptr;
-    Link<TYPE>* last_link = nullptr;
+    /// <summary>
+    ///    
+    /// </summary>
+    static void joinAll(std::vector<std::thread>& threads) {
+        for (std::thread& thread : threads) {
+            if (thread.joinable()) {
+                thread.join();
+            }
+        }
+    }
+
+    /// <summary>
+    ///    :    , 
+    ///   ,      prev.
+    ///      ;    ( 
+    ///  ) ,   ,   
+    ///     
+    /// </summary>
+    template <typename Compare, typename SortPart>
+    void sortInParts(size_t threads, size_t serialThreshold, Compare less, SortPart sortPart) {
+        if (threads == 0) {
+            threads = std::thread::hardware_concurrency();
+        }
+        size_t count = chain_size / (serialThreshold == 0 ? 1 : serialThreshold);
+        if (count > threads) {
+            count = threads;
+        }
+        if (count <= 1) {
+            sortPart(*this);
+            return;
+        }
+
+        //    :    
+        size_t total = chain_size;
+        std::vector<Chain2> parts;
+        parts.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            parts.emplace_back(allocator);
+        }
+        std::vector<std::thread> workers;
+        workers.reserve(count - 1);
+        std::vector<std::thread> mergers;
+        mergers.reserve(count / 2);
+        std::vector<Link<TYPE>*> runs(count);
+        std::vector<Link<TYPE>*> merged(count);
+
+        Link<TYPE>* link = first_link;
+        for (size_t i = 0; i < count; ++i) {
+            size_t size = total / count + (i < total % count ? 1 : 0);
+            Chain2& part = parts[i];
+            part.first_link = link;
+            for (size_t j = 1; j < size; ++j) {
+                link = link->getNext();
+            }
+            part.last_link = link;
+            part.chain_size = size;
+            link = link->getNext();
+            part.first_link->setPrev(nullptr);
+            part.last_link->setNext(nullptr);
+        }
+        first_link = nullptr;
+        last_link = nullptr;
+        chain_size = 0;
+        invalidateIndex();
+
+        //    ,      
+        auto takeParts = [&parts, &runs, count]() {
+            for (size_t i = 0; i < count; ++i) {
+                runs[i] = parts[i].first_link;
+                parts[i].first_link = nullptr;
+                parts[i].last_link = nullptr;
+                parts[i].chain_size = 0;
+            }
+        };
+
+        try {
+            for (size_t i = 1; i < count; ++i) {
+                workers.emplace_back([&sortPart, &parts, i] { sortPart(parts[i]); });
+            }
+            sortPart(parts[0]);
+        }
+        catch (...) {
+            joinAll(workers);
+            takeParts();
+            adoptRuns(runs.data(), count, total);
+            throw;
+        }
+        joinAll(workers);
+        takeParts();
+
+        //   :  ,    ()
+        size_t runCount = count;
+        while (runCount > 1) {
+            size_t pairs = (runCount + 1) / 2;
+            std::fill(merged.begin(), merged.begin() + pairs, nullptr);
+            mergers.clear();
+            try {
+                for (size_t i = 2; i + 1 < runCount; i += 2) {
+                    mergers.emplace_back([&runs, &merged, less, i]() mutable { merged[i / 2] = mergeRuns(runs[i], runs[i + 1], less); });
+                }
+                merged[0] = mergeRuns(runs[0], runs[1], less);
+            }
+            catch (...) {
+                //    ,    ;
+                //   runs   
+                joinAll(mergers);
+                size_t kept = 0;
+                for (size_t p = 0; p < pairs; ++p) {
+                    Link<TYPE>* left = runs[2 * p];
+                    Link<TYPE>* right = 2 * p + 1 < runCount ? runs[2 * p + 1] : nullptr;
+                    if (merged[p] != nullptr) {
+                        runs[kept++] = merged[p];
+                        continue;
+                    }
+                    runs[kept++] = left;
+                    if (right != nullptr) {
+                        runs[kept++] = right;
+                    }
+                }
+                adoptRuns(runs.data(), kept, total);
+                throw;
+            }
+            if (runCount % 2 != 0) {
+                merged[pairs - 1] = runs[runCount - 1];
+            }
+            joinAll(mergers);
+            runs.swap(merged);
+            runCount = pairs;
+        }
+
+        adoptRuns(runs.data(), 1, total);
+    }
 
     /// <summary>
     ///  
     /// </summary>
     class NodeAdder {
     private:
-        Chain2<TYPE>* chain;
+        Chain2* chain;
 
     public:
-        NodeAdder(Chain2<TYPE>* chain) : chain(chain) {}
+        NodeAdder(Chain2* chain) : chain(chain) {}
 
         /// <summary>
         ///   
         /// </summary>
         /// <param name="value">  </param>
         void front(TYPE value) {
-            Link<TYPE>* newLink = new Link<TYPE>(value);
+            Link<TYPE>* newLink = chain->allocator.create(value);
             if (chain->isEmpty()) {
                 chain->first_link = newLink;
                 chain->last_link = newLink;
@@ -112,7 +1372,7 @@ private:
                 chain->first_link->setPrev(newLink);
                 chain->first_link = newLink;
             }
-            updateIndexes(chain->first_link);
+            chain->trackInsert(newLink, 0);
             chain->chain_size++;
         }
 
@@ -121,7 +1381,7 @@ private:
         /// </summary>
         /// <param name="value">  </param>
         void back(TYPE value) {
-            Link<TYPE>* newLink = new Link<TYPE>(value);
+            Link<TYPE>* newLink = chain->allocator.create(value);
             if (chain->isEmpty()) {
                 chain->first_link = newLink;
                 chain->last_link = newLink;
@@ -131,10 +1391,21 @@ private:
                 newLink->setPrev(chain->last_link);
                 chain->last_link = newLink;
             }
-            updateIndexes(chain->last_link);
+            chain->trackInsert(newLink, chain->chain_size);
             chain->chain_size++;
         }
 
+        /// <summary>
+        ///      [first, last).   
+        ///     (     )    
+        /// </summary>
+        /// <param name="first">   </param>
+        /// <param name="last">   </param>
+        template <typename InputIt>
+        void range(InputIt first, InputIt last) {
+            range(first, last, typename std::iterator_traits<InputIt>::iterator_category());
+        }
+
         /// <summary>
         ///      
         /// </summary>
@@ -150,29 +1421,32 @@ private:
                 return;
             }
             chain->seek(index);
-            Link<TYPE>* newLink = new Link<TYPE>(value);
+            Link<TYPE>* newLink = chain->allocator.create(value);
             Link<TYPE>* prev = chain->current_link->getPrev();
             newLink->setNext(chain->current_link);
             newLink->setPrev(prev);
             prev->setNext(newLink);
             chain->current_link->setPrev(newLink);
-            updateIndexes(chain->current_link);
+            chain->trackInsert(newLink, index);
             chain->chain_size++;
         }
 
-        /// <summary>
-        ///     
-        /// </summary>
-        /// <param name="startNode"> ,     </param>
-        void updateIndexes(Link<TYPE>* startNode) {
-            Link<TYPE>* current = startNode;
-            size_t index = startNode->getIndex();
-            while (current != nullptr) {
-                current->setIndex(index++);
-                current = current->getNext();
+    private:
+        template <typename InputIt>
+        void range(InputIt first, InputIt last, std::input_iterator_tag) {
+            for (; first != last; ++first) {
+                back(*first);
             }
         }
 
+        template <typename ForwardIt>
+        void range(ForwardIt first, ForwardIt last, std::forward_iterator_tag) {
+            chain->appendRun(static_cast<size_t>(std::distance(first, last)), [&first]() {
+                TYPE value = *first;
+                ++first;
+                return value;
+            });
+        }
     };
 
     /// <summary>
@@ -180,10 +1454,10 @@ private:
     /// </summary>
     class NodeDeleter {
     private:
-        Chain2<TYPE>* chain;
+        Chain2* chain;
 
     public:
-        NodeDeleter(Chain2<TYPE>* chain) : chain(chain) {}
+        NodeDeleter(Chain2* chain) : chain(chain) {}
 
         /// <summary>
         ///  
@@ -193,6 +1467,7 @@ private:
                 return;
             }
             Link<TYPE>* tmp = chain->first_link;
+            chain->trackErase(tmp, 0);
             chain->first_link = chain->first_link->getNext();
             if (chain->first_link != nullptr) {
                 chain->first_link->setPrev(nullptr);
@@ -200,7 +1475,7 @@ private:
             else {
                 chain->last_link = nullptr;
             }
-            delete tmp;
+            chain->allocator.destroy(tmp);
             chain->chain_size--;
         }
 
@@ -212,6 +1487,7 @@ private:
                 return;
             }
             Link<TYPE>* tmp = chain->last_link;
+            chain->trackErase(tmp, chain->chain_size - 1);
             chain->last_link = chain->last_link->getPrev();
             if (chain->last_link != nullptr) {
                 chain->last_link->setNext(nullptr);
@@ -219,7 +1495,7 @@ private:
             else {
                 chain->first_link = nullptr;
             }
-            delete tmp;
+            chain->allocator.destroy(tmp);
             chain->chain_size--;
         }
 
@@ -240,9 +1516,10 @@ private:
                 back();
             }
             else {
-                chain->current_link->getPrev()->setNext(chain->current_link->getNext());
-                chain->current_link->getNext()->setPrev(chain->current_link->getPrev());
-                delete tmp;
+                chain->trackErase(tmp, index);
+                tmp->getPrev()->setNext(tmp->getNext());
+                tmp->getNext()->setPrev(tmp->getPrev());
+                chain->allocator.destroy(tmp);
                 chain->chain_size--;
             }
         }
@@ -255,6 +1532,13 @@ public:
     /// </summary>
     Chain2() {}
 
+    /// <summary>
+    ///       
+    /// ( PoolLinkAllocator   )
+    /// </summary>
+    /// <param name="allocator">   </param>
+    explicit Chain2(const Allocator& allocator) : allocator(allocator) {}
+
     /// <summary>
     ///  
     /// </summary>
@@ -270,9 +1554,21 @@ public:
     /// </summary>
     /// <param name="value">  </param>
     Chain2(TYPE value) : chain_size(1) {
-        current_link = new Link<TYPE>(value);
+        current_link = allocator.create(value);
         first_link = current_link;
         last_link = current_link;
+        current_ranked = true;
+    }
+
+    /// <summary>
+    ///     [first, last)
+    /// </summary>
+    /// <param name="first">   </param>
+    /// <param name="last">   </param>
+    /// <param name="allocator">   </param>
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    Chain2(InputIt first, InputIt last, const Allocator& allocator = Allocator()) : allocator(allocator) {
+        adder.range(first, last);
     }
 
     /// <summary>
@@ -286,12 +1582,8 @@ public:
     ///  
     /// </summary>
     /// <param name="other"></param>
-    Chain2(const Chain2& other) : chain_size(other.chain_size), current_link(nullptr), first_link(nullptr), last_link(nullptr) {
-        Link<TYPE>* other_current = other.first_link;
-        while (other_current != nullptr) {
-            adder.back(other_current->getData());
-            other_current = other_current->getNext();
-        }
+    Chain2(const Chain2& other) : allocator(other.allocator), finger_capacity(other.finger_capacity) {
+        appendCopy(other);
     }
 
     /// <summary>
@@ -302,12 +1594,8 @@ public:
     Chain2& operator=(const Chain2& other) {
         if (this != &other) {
             clear();
-            chain_size = other.chain_size;
-            Link<TYPE>* other_current = other.first_link;
-            while (other_current != nullptr) {
-                adder.back(other_current->getData());
-                other_current = other_current->getNext();
-            }
+            setFingerCache(other.finger_capacity);
+            appendCopy(other);
         }
         return *this;
     }
@@ -316,7 +1604,10 @@ public:
     ///  
     /// </summary>
     /// <param name="other"></param>
-    Chain2(Chain2&& other) noexcept : chain_size(other.chain_size), current_link(other.current_link), first_link(other.first_link), last_link(other.last_link) {
+    Chain2(Chain2&& other) noexcept : allocator(other.allocator), chain_size(other.chain_size), current_link(other.current_link), first_link(other.first_link), last_link(other.last_link),
+        lanes(std::move(other.lanes)), lanes_valid(other.lanes_valid), rank_shift(other.rank_shift),
+        current_ranked(other.current_ranked), current_rank(other.current_rank), finger_capacity(other.finger_capacity) {
+        other.invalidateIndex();
         other.chain_size = 0;
         other.current_link = nullptr;
         other.first_link = nullptr;
@@ -331,11 +1622,19 @@ public:
     Chain2& operator=(Chain2&& other) noexcept {
         if (this != &other) {
             clear();
+            allocator = other.allocator; //    ,   
             chain_size = other.chain_size;
             current_link = other.current_link;
             first_link = other.first_link;
             last_link = other.last_link;
-
+            lanes = std::move(other.lanes);
+            lanes_valid = other.lanes_valid;
+            rank_shift = other.rank_shift;
+            current_ranked = other.current_ranked;
+            current_rank = other.current_rank;
+            setFingerCache(other.finger_capacity);
+
+            other.invalidateIndex();
             other.chain_size = 0;
             other.current_link = nullptr;
             other.first_link = nullptr;
@@ -356,6 +1655,7 @@ public:
     void right() {
         if (current_link->getNext() != nullptr) {
             current_link = current_link->getNext();
+            ++current_rank;
         }
     }
 
@@ -365,32 +1665,60 @@ public:
     void left() {
         if (current_link->getPrev() != nullptr) {
             current_link = current_link->getPrev();
+            --current_rank;
         }
     }
 
     /// <summary>
-    ///    
+    ///    :    , , 
+    ///  ,        O(log n)
     /// </summary>
     /// <param name="index"></param>
     void seek(size_t index)
     {
-        bool mode = false;
-        if (index >= chain_size && index < 0)
-            if (index >= chain_size && index < 0)
-                mode = true; else mode = false;
-        while (index != current_link->getIndex())
-            if (mode) right(); else left();
+        if (index >= chain_size) {
+            throw std::out_of_range("Chain2 index out of range!");
+        }
+        current_link = linkAt(index);
+        current_rank = index;
+        current_ranked = true;
+    }
+
+    /// <summary>
+    ///    (  8;   0   ).
+    ///         ,
+    ///       
+    /// </summary>
+    /// <param name="count">   </param>
+    void setFingerCache(size_t count) {
+        finger_capacity = count < maxFingers ? count : static_cast<size_t>(maxFingers);
+        finger_count = 0;
+        finger_next = 0;
     }
 
+    /// <summary>
+    ///   
+    /// </summary>
+    /// <returns>   (0   ) </returns>
+    size_t getFingerCache() const { return finger_capacity; }
+
     /// <summary>
     ///   
     /// </summary>
-    void toStart() { current_link = first_link; }
+    void toStart() {
+        current_link = first_link;
+        current_rank = 0;
+        current_ranked = current_link != nullptr;
+    }
 
     /// <summary>
     ///   
     /// </summary>
-    void toEnd() { current_link = last_link; }
+    void toEnd() {
+        current_link = last_link;
+        current_rank = chain_size - 1;
+        current_ranked = current_link != nullptr;
+    }
 
     /// <summary>
     ///   
@@ -407,33 +1735,81 @@ public:
     }
 
     /// <summary>
-    ///  
+    ///  :    , O(n log n).
+    ///  ,   ;  
+    ///    
     /// </summary>
-    void sort() {
+    /// <param name="less">    </param>
+    template <typename Compare = std::less<TYPE>>
+    void sort(Compare less = Compare()) {
         if (chain_size <= 1) {
             return;
         }
 
-        Link<TYPE>* current = first_link->getNext();
-        while (current != nullptr) {
-            Link<TYPE>* key = current;
-            TYPE keyValue = key->getData();
-            Link<TYPE>* prev = key->getPrev();
-
-            while (prev != nullptr && prev->getData() > keyValue) {
-                prev->getNext()->setData(prev->getData());
-                prev = prev->getPrev();
+        // bins[i]   ,   ~2^i  ;
+        //        (  )
+        Link<TYPE>* bins[64] = {};
+        size_t used = 0;
+        Link<TYPE>* rest = first_link;
+        while (rest != nullptr) {
+            Link<TYPE>* run = takeRun(rest, less);
+            size_t i = 0;
+            for (; i < 63 && bins[i] != nullptr; ++i) {
+                run = mergeRuns(bins[i], run, less);
+                bins[i] = nullptr;
             }
-
-            if (prev == nullptr) {
-                first_link->setData(keyValue);
+            if (bins[i] != nullptr) {
+                run = mergeRuns(bins[i], run, less);
             }
-            else {
-                prev->getNext()->setData(keyValue);
+            bins[i] = run;
+            if (i >= used) {
+                used = i + 1;
+            }
+        }
+        Link<TYPE>* result = nullptr;
+        for (size_t i = 0; i < used; ++i) {
+            if (bins[i] != nullptr) {
+                result = result == nullptr ? bins[i] : mergeRuns(bins[i], result, less);
             }
+        }
 
-            current = current->getNext();
+        //  prev     
+        first_link = result;
+        Link<TYPE>* prev = nullptr;
+        for (Link<TYPE>* link = result; link != nullptr; link = link->getNext()) {
+            link->setPrev(prev);
+            prev = link;
         }
+        last_link = prev;
+        invalidateIndex();
+    }
+
+    /// <summary>
+    ///  :       , 
+    ///   (sort),      .
+    ///  ;     
+    ///     
+    /// </summary>
+    /// <param name="threads">   (0  std::thread::hardware_concurrency) </param>
+    /// <param name="serialThreshold">     :  
+    ///        </param>
+    /// <param name="less">    </param>
+    template <typename Compare = std::less<TYPE>>
+    void parallelSort(size_t threads = 0, size_t serialThreshold = 65536, Compare less = Compare()) {
+        sortInParts(threads, serialThreshold, less, [less](Chain2& part) { part.sort(less); });
+    }
+
+    /// <summary>
+    ///   :   radixSort,
+    ///         (RadixKey), 
+    /// NaN      ,    radixSort
+    /// </summary>
+    /// <param name="threads">   (0  std::thread::hardware_concurrency) </param>
+    /// <param name="serialThreshold">      </param>
+    void parallelRadixSort(size_t threads = 0, size_t serialThreshold = 65536) {
+        sortInParts(threads, serialThreshold,
+            [](const TYPE& a, const TYPE& b) { return RadixKey<TYPE>::get(a) < RadixKey<TYPE>::get(b); },
+            [](Chain2& part) { part.radixSort(); });
     }
 
     /// <summary>
@@ -454,72 +1830,108 @@ public:
 
 
     /// <summary>
-    ///  
+    ///  :  other     O(1)
     /// </summary>
     /// <param name="other">   </param>
     void concatenate(Chain2& other) {
-        if (other.getSize() == 0) {
+        if (other.chain_size == 0 || &other == this) {
             return;
         }
-
-        if (chain_size == 0) {
-            first_link = other.first_link;
-            last_link = other.last_link;
-            chain_size = other.chain_size;
-        }
-        else {
-            last_link->setNext(other.first_link);
-            other.first_link->setPrev(last_link);
-            last_link = other.last_link;
-            chain_size += other.chain_size;
-        }
-
-        other.chain_size = 0;
-        other.first_link = nullptr;
-        other.last_link = nullptr;
+        splice(chain_size, other, 0, other.chain_size);
     }
 
     /// <summary>
-    ///      
+    ///      :     index ,
+    ///    secondList (   ).
+    ///       (   ,   )
     /// </summary>
     /// <param name="index">   </param>
     /// <param name="secondList"> ,     </param>
     void divide(size_t index, Chain2& secondList) {
-        if (index >= chain_size) {
+        if (index >= chain_size || &secondList == this) {
             return;
         }
+        secondList.clear();
+        secondList.splice(0, *this, index, chain_size);
+    }
 
-        Link<TYPE>* ptr = first_link;
-        size_t count = 0;
-        while (count < index) {
-            ptr = ptr->getNext();
-            count++;
+    /// <summary>
+    ///   [from, to)  other      index.
+    ///  : O( )      
+    ///  ;          .
+    ///     ,  
+    /// </summary>
+    /// <param name="index">      (0..getSize()) </param>
+    /// <param name="other"> - (  ) </param>
+    /// <param name="from">    other </param>
+    /// <param name="to">    other ( ) </param>
+    void splice(size_t index, Chain2& other, size_t from, size_t to) {
+        if (&other == this) {
+            throw std::invalid_argument("Chain2::splice requires two different chains!");
+        }
+        if (from > to || to > other.chain_size || index > chain_size) {
+            throw std::out_of_range("Chain2::splice range out of bounds!");
+        }
+        if (from == to) {
+            return;
+        }
+        size_t count = to - from;
+
+        if (allocator != other.allocator) {
+            //        
+            Chain2 copies(allocator);
+            Link<TYPE>* link = other.linkAt(from, false);
+            for (size_t i = 0; i < count; ++i, link = link->getNext()) {
+                copies.adder.back(link->getData());
+            }
+            other.destroyRange(from, to);
+            splice(index, copies, 0, count);
+            return;
         }
 
-        secondList.first_link = ptr->getNext();
-        secondList.last_link = last_link;
-        secondList.chain_size = chain_size - index;
-
-        last_link = ptr;
-        last_link->setNext(nullptr);
-        chain_size = index;
+        Link<TYPE>* first = other.linkAt(from, false);
+        Link<TYPE>* last = other.last_link;
+        if (to != other.chain_size) {
+            if (count - 1 <= other.chain_size - to) {
+                last = first;
+                for (size_t i = 1; i < count; ++i) {
+                    last = last->getNext();
+                }
+            }
+            else {
+                last = other.linkAt(to - 1, false);
+            }
+        }
+        other.unlinkRange(first, last, from, to);
+        linkRange(first, last, index, count);
     }
 
     /// <summary>
-    ///  
+    ///  .    ,
+    ///       
     /// </summary>
     void clear() {
         Link<TYPE>* current = first_link;
         while (current != nullptr) {
             Link<TYPE>* next = current->getNext();
-            delete current;
+            allocator.destroy(current);
             current = next;
         }
         first_link = nullptr;
         last_link = nullptr;
+        current_link = nullptr;
         chain_size = 0;
+        lanes.clear();
+        rank_shift = 0;
+        invalidateIndex();
+        allocator.release();
     }
 
+    /// <summary>
+    ///   
+    /// </summary>
+    const Allocator& getAllocator() const { return allocator; }
+
     Link<TYPE>* getCurrent() { return current_link; }
     Link<TYPE>* getLast() { return last_link; }
     Link<TYPE>* getFirst() { return first_link; }
@@ -531,7 +1943,7 @@ public:
     /// <param name="os"></param>
     /// <param name="chain"></param>
     /// <returns></returns>
-    friend std::ostream& operator<<(std::ostream& os, const Chain2<TYPE>& chain) {
+    friend std::ostream& operator<<(std::ostream& os, const Chain2& chain) {
         Link<TYPE>* ptr = chain.first_link;
         while (ptr != nullptr) {
             os << ptr->getData();
@@ -544,75 +1956,104 @@ public:
     }
 
     /// <summary>
-    ///    Radix Sort
+    ///   (LSD)    :  
+    ///   , 256 -,  .   
+    ///       float/double (. RadixKey).  ,
+    ///       .    
+    ///  ,    ,   
     /// </summary>
     void radixSort() {
+        static_assert(std::is_arithmetic<TYPE>::value, "Chain2::radixSort requires an integral or floating-point TYPE.");
         if (chain_size <= 1) {
             return;
         }
 
-        //     
-        TYPE max = first_link->getData();
-        Link<TYPE>* current = first_link->getNext();
-        while (current != nullptr) {
-            if (current->getData() > max) {
-                max = current->getData();
+        typedef RadixKey<TYPE> Radix;
+        typedef typename Radix::type Key;
+        const size_t passes = sizeof(Key);
+        size_t counts[sizeof(Key)][256] = {};
+        for (Link<TYPE>* link = first_link; link != nullptr; link = link->getNext()) {
+            Key key = Radix::get(link->getDataRef());
+            for (size_t pass = 0; pass < passes; ++pass) {
+                ++counts[pass][(key >> (8 * pass)) & 0xFF];
             }
-            current = current->getNext();
         }
 
-        //    
-        for (int exp = 1; max / exp > 0; exp *= 10) {
-            std::vector<std::vector<Link<TYPE>*>> buckets(10);
+        Link<TYPE>* heads[256];
+        Link<TYPE>* tails[256];
+        bool moved = false;
+        for (size_t pass = 0; pass < passes; ++pass) {
+            size_t shift = 8 * pass;
+            if (counts[pass][(Radix::get(first_link->getDataRef()) >> shift) & 0xFF] == chain_size) {
+                continue; //         
+            }
 
-            //     (buckets)
-            current = first_link;
-            while (current != nullptr) {
-                int index = (current->getData() / exp) % 10;
-                buckets[index].push_back(current);
-                current = current->getNext();
+            //       ()
+            std::fill(heads, heads + 256, nullptr);
+            for (Link<TYPE>* link = first_link; link != nullptr; link = link->getNext()) {
+                size_t digit = (Radix::get(link->getDataRef()) >> shift) & 0xFF;
+                if (heads[digit] != nullptr) {
+                    tails[digit]->setNext(link);
+                }
+                else {
+                    heads[digit] = link;
+                }
+                tails[digit] = link;
             }
 
-            //     
-            first_link = nullptr;
-            last_link = nullptr;
-            for (int i = 0; i < 10; ++i) {
-                for (Link<TYPE>* link : buckets[i]) {
-                    if (first_link == nullptr) {
-                        first_link = link;
-                    }
-                    if (last_link != nullptr) {
-                        last_link->setNext(link);
-                        link->setPrev(last_link);
-                    }
-                    link->setPrev(last_link);
-                    link->setNext(nullptr);
-                    last_link = link;
+            //     
+            Link<TYPE>* tail = nullptr;
+            for (size_t digit = 0; digit < 256; ++digit) {
+                if (heads[digit] == nullptr) {
+                    continue;
+                }
+                if (tail != nullptr) {
+                    tail->setNext(heads[digit]);
+                }
+                else {
+                    first_link = heads[digit];
                 }
+                tail = tails[digit];
             }
+            tail->setNext(nullptr);
+            last_link = tail;
+            moved = true;
+        }
+        if (!moved) {
+            return;
+        }
+
+        Link<TYPE>* prev = nullptr;
+        for (Link<TYPE>* link = first_link; link != nullptr; link = link->getNext()) {
+            link->setPrev(prev);
+            prev = link;
         }
+        invalidateIndex();
     }
     public:
         // 
         class Iterator {
         private:
             Link<TYPE>* current;
+            Chain2* chain; //     end()   
 
         public:
-            Iterator(Link<TYPE>* start) : current(start) {}
+            Iterator(Link<TYPE>* start, Chain2* chain) : current(start), chain(chain) {}
 
             Iterator& operator++() {
                 if (current) current = current->getNext();
                 return *this;
             }
 
+            ///  end()    ,      
             Iterator& operator--() {
-                if (current) current = current->getPrev();
+                if (current == nullptr) current = chain->last_link;
+                else if (current->getPrev() != nullptr) current = current->getPrev();
                 return *this;
             }
 
-            TYPE operator*() const {
-                return current->getData();
+            TYPE& operator*() const {
+                return current->getDataRef();
             }
 
             bool operator!=(const Iterator& other) const {
@@ -627,10 +2068,10 @@ public:
 
         
         Iterator begin() {
-            return Iterator(first_link);
+            return Iterator(first_link, this);
         }
 
         Iterator end() {
-            return Iterator(nullptr);
+            return Iterator(nullptr, this);
         }
 };
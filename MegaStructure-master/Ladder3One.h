@@ -3,6 +3,7 @@
 #include <iostream>
 #include <regex>
 #include <string>
+#include <limits> //  std::numeric_limits
 
 /// <summary>
 ///   
@@ -1,12 +1,44 @@
-﻿#include <iostream>
-#include "C:\Users\FouRth\Desktop\Projects in Cpp\MegaHeap\MegaHeap\Chain2.h"
+﻿#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <sstream>
+#include "Chain2.h"
 #include "HeavyIronWell.h"
 #include "Ladder3One.h"
 #include "QSnake.h"
+#include "UnrolledChain.h"
 #include <cassert>
 
 using namespace std;
 
+// Счётчик глобальных выделений памяти: проверка, что пул не уходит в operator new
+static std::atomic<size_t> globalAllocations(0);
+
+void* operator new(std::size_t size) {
+    globalAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) { return operator new(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    globalAllocations.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size == 0 ? 1 : size);
+}
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept { return operator new(size, tag); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
 void testChain2() {
     // Тест создания списка с одним элементом
     Chain2<int> chain(5);
@@ -96,8 +128,9 @@ void testChain2() {
     unsortedChain.divide(2, secondChain);
     assert(unsortedChain.getSize() == 2);
     assert(secondChain.getSize() == 3);
-    assert(unsortedChain.getLast()->getData() == 4);
-    assert(secondChain.getFirst()->getData() == 7);
+    assert(unsortedChain.getLast()->getData() == 2);
+    assert(secondChain.getFirst()->getData() == 4);
+    assert(secondChain.getFirst()->getPrev() == nullptr);
 
     // Тест объединения двух списков
     unsortedChain.concatenate(secondChain);
@@ -106,6 +139,546 @@ void testChain2() {
     assert(unsortedChain.getLast()->getData() == 9);
 }
 
+void testChain2Pool() {
+    // Тест: звенья берутся из пула блоками
+    PoolLinkAllocator<int> pool(4);
+    Chain2<int, PoolLinkAllocator<int>> chain(pool);
+    for (int i = 0; i < 10; ++i) {
+        chain.adder.back(i);
+    }
+    assert(chain.getSize() == 10);
+    assert(pool.getPool().liveCount() == 10);
+    assert(pool.getPool().slabCount() == 3);
+
+    // Тест: освобождённые звенья переиспользуются без новых блоков
+    chain.deleter.front();
+    chain.deleter.back();
+    chain.adder.front(-1);
+    chain.adder.back(100);
+    assert(pool.getPool().slabCount() == 3);
+    assert(chain.getFirst()->getData() == -1 && chain.getLast()->getData() == 100);
+
+    // Тест: две цепи на общем пуле, блоки освобождаются, когда обе пусты
+    Chain2<int, PoolLinkAllocator<int>> other(pool);
+    other.adder.back(7);
+    other.adder.back(8);
+    chain.concatenate(other);
+    assert(chain.getSize() == 12 && chain.getLast()->getData() == 8);
+    other.adder.back(9);
+    chain.clear();
+    assert(pool.getPool().slabCount() != 0);
+    other.clear();
+    assert(pool.getPool().slabCount() == 0 && pool.getPool().liveCount() == 0);
+
+    // Тест: перенос между цепями с разными пулами копирует значения
+    Chain2<int, PoolLinkAllocator<int>> first;
+    Chain2<int, PoolLinkAllocator<int>> second;
+    first.adder.back(1);
+    second.adder.back(2);
+    second.adder.back(3);
+    first.concatenate(second);
+    assert(first.getSize() == 3 && second.getSize() == 0);
+    assert(first.toArray() == std::vector<int>({ 1, 2, 3 }));
+    assert(second.getAllocator().getPool().slabCount() == 0);
+    assert(first.getAllocator().getPool().liveCount() == 3);
+
+    // Тест: сортировки работают поверх пула
+    first.adder.front(9);
+    first.radixSort();
+    assert(first.toArray() == std::vector<int>({ 1, 2, 3, 9 }));
+
+    // Тест: башни индекса позиций тоже берутся из пула блоками, а не по одной
+    PoolLinkAllocator<int> big(4096);
+    Chain2<int, PoolLinkAllocator<int>> indexed(big);
+    for (int i = 0; i < 100000; ++i) {
+        indexed.adder.back(i);
+    }
+    size_t before = globalAllocations.load();
+    indexed.seek(50000);
+    assert(indexed.getCurrent()->getData() == 50000);
+    assert(globalAllocations.load() - before < 40);
+    assert(big.getPool().towerSlabCount() > 0);
+    before = globalAllocations.load();
+    for (int i = 0; i < 10000; ++i) {
+        indexed.adder.at(indexed.getSize() / 2, -i);
+    }
+    assert(globalAllocations.load() - before < 40);
+    indexed.seek(1000);
+    assert(indexed.getCurrent()->getData() == 1000);
+    indexed.clear();
+    assert(big.getPool().towerSlabCount() == 0 && big.getPool().slabCount() == 0);
+}
+
+void testChain2Index() {
+    // Тест: позиционный доступ без сквозной нумерации звеньев.
+    // Эталон — std::vector, операции на концах и в середине вперемешку
+    Chain2<int> chain;
+    std::vector<int> expected;
+    for (int i = 0; i < 2000; ++i) {
+        chain.adder.front(i);
+        expected.insert(expected.begin(), i);
+    }
+    chain.seek(0);
+    assert(chain.getCurrent()->getData() == 1999);
+    chain.seek(1999);
+    assert(chain.getCurrent() == chain.getLast());
+
+    unsigned state = 12345;
+    for (int step = 0; step < 4000; ++step) {
+        state = state * 1103515245u + 12345u;
+        size_t position = (state >> 8) % (expected.size() + 1);
+        switch ((state >> 4) % 6) {
+        case 0: chain.adder.front(step); expected.insert(expected.begin(), step); break;
+        case 1: chain.adder.back(step); expected.push_back(step); break;
+        case 2: case 3: chain.adder.at(position, step); expected.insert(expected.begin() + std::min(position, expected.size()), step); break;
+        case 4: if (position < expected.size()) { chain.deleter.at(position); expected.erase(expected.begin() + position); } break;
+        default: chain.deleter.front(); chain.deleter.back(); expected.erase(expected.begin()); expected.pop_back(); break;
+        }
+        size_t probe = (state >> 12) % expected.size();
+        chain.seek(probe);
+        assert(chain.getCurrent()->getData() == expected[probe]);
+    }
+    assert(chain.getSize() == expected.size());
+    assert(chain.toArray() == expected);
+    for (size_t i = 0; i < expected.size(); i += 7) {
+        chain.seek(i);
+        assert(chain.getCurrent()->getData() == expected[i]);
+    }
+
+    // Тест: индекс перестраивается после перелинковки
+    Chain2<int> tail;
+    chain.divide(chain.getSize() / 2, tail);
+    chain.concatenate(tail);
+    chain.radixSort();
+    std::sort(expected.begin(), expected.end());
+    for (size_t i = 0; i < expected.size(); i += 5) {
+        chain.seek(i);
+        assert(chain.getCurrent()->getData() == expected[i]);
+    }
+
+    // Тест: выход за границы
+    bool thrown = false;
+    try {
+        chain.seek(chain.getSize());
+    }
+    catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+}
+
+void testChain2Finger() {
+    // Тест: кластерные правки рядом с закладками при разных размерах кэша
+    for (size_t fingers = 0; fingers <= 8; fingers += 4) {
+        Chain2<int> chain;
+        chain.setFingerCache(fingers);
+        std::vector<int> expected;
+        for (int i = 0; i < 500; ++i) {
+            chain.adder.back(i);
+            expected.push_back(i);
+        }
+        unsigned state = 777;
+        size_t spot[3] = { 10, 250, 480 };
+        for (int step = 0; step < 3000; ++step) {
+            state = state * 1103515245u + 12345u;
+            size_t& position = spot[(state >> 10) % 3];
+            position = (position + (state >> 16) % 5 + expected.size() - 2) % expected.size();
+            if ((state >> 8) % 2 == 0) {
+                chain.adder.at(position, step);
+                expected.insert(expected.begin() + position, step);
+            }
+            else {
+                chain.deleter.at(position);
+                expected.erase(expected.begin() + position);
+            }
+            chain.seek(position % expected.size());
+            assert(chain.getCurrent()->getData() == expected[position % expected.size()]);
+        }
+        assert(chain.toArray() == expected);
+    }
+
+    // Тест: курсор с удалённого звена переходит на соседнее и сохраняет позицию
+    Chain2<int> chain;
+    for (int i = 0; i < 10; ++i) {
+        chain.adder.back(i);
+    }
+    chain.seek(4);
+    chain.deleter.at(4);
+    assert(chain.getCurrent()->getData() == 5);
+    chain.right();
+    chain.adder.at(0, -1);
+    chain.seek(7);
+    assert(chain.getCurrent()->getData() == 7);
+    chain.toEnd();
+    chain.deleter.back();
+    assert(chain.getCurrent() == chain.getLast() && chain.getLast()->getData() == 8);
+    chain.left();
+    chain.seek(1);
+    assert(chain.getCurrent()->getData() == 0);
+}
+
+void testChain2Splice() {
+    // Тест: перенос диапазонов между цепями против эталонных векторов
+    Chain2<int> chain;
+    Chain2<int> other;
+    std::vector<int> expected;
+    std::vector<int> expectedOther;
+    for (int i = 0; i < 300; ++i) {
+        chain.adder.back(i);
+        expected.push_back(i);
+        other.adder.back(1000 + i);
+        expectedOther.push_back(1000 + i);
+    }
+    chain.setFingerCache(4);
+    chain.seek(150);
+    other.seek(20);
+    unsigned state = 4242;
+    for (int step = 0; step < 300; ++step) {
+        state = state * 1103515245u + 12345u;
+        bool forward = (state >> 20) % 2 == 0;
+        Chain2<int>& from = forward ? other : chain;
+        Chain2<int>& to = forward ? chain : other;
+        std::vector<int>& source = forward ? expectedOther : expected;
+        std::vector<int>& target = forward ? expected : expectedOther;
+        size_t first = (state >> 4) % (source.size() + 1);
+        size_t last = first + (state >> 12) % (source.size() - first + 1);
+        size_t index = (state >> 8) % (target.size() + 1);
+        to.splice(index, from, first, last);
+        target.insert(target.begin() + index, source.begin() + first, source.begin() + last);
+        source.erase(source.begin() + first, source.begin() + last);
+        assert(chain.getSize() == expected.size() && other.getSize() == expectedOther.size());
+        if (!expected.empty()) {
+            size_t probe = (state >> 16) % expected.size();
+            chain.seek(probe);
+            assert(chain.getCurrent()->getData() == expected[probe]);
+        }
+    }
+    assert(chain.toArray() == expected);
+    assert(other.toArray() == expectedOther);
+
+    // Тест: divide оставляет первые index элементов, prev согласованы, индекс работает
+    Chain2<int> big;
+    for (int i = 0; i < 1000; ++i) {
+        big.adder.back(i);
+    }
+    big.seek(900);
+    Chain2<int> rest;
+    rest.adder.back(-1);
+    big.divide(600, rest);
+    assert(big.getSize() == 600 && rest.getSize() == 400);
+    assert(big.getLast()->getData() == 599 && big.getLast()->getNext() == nullptr);
+    assert(rest.getFirst()->getData() == 600 && rest.getFirst()->getPrev() == nullptr);
+    assert(big.getCurrent() == big.getLast());
+    big.seek(300);
+    assert(big.getCurrent()->getData() == 300);
+    rest.seek(399);
+    assert(rest.getCurrent()->getData() == 999);
+    big.adder.back(600);
+    big.deleter.at(10);
+    big.seek(598);
+    assert(big.getCurrent()->getData() == 599);
+
+    // Тест: перенос между цепями с разными пулами копирует значения
+    Chain2<int, PoolLinkAllocator<int>> left;
+    Chain2<int, PoolLinkAllocator<int>> right;
+    for (int i = 0; i < 6; ++i) {
+        left.adder.back(i);
+        right.adder.back(10 + i);
+    }
+    left.splice(3, right, 1, 4);
+    assert(left.toArray() == std::vector<int>({ 0, 1, 2, 11, 12, 13, 3, 4, 5 }));
+    assert(right.toArray() == std::vector<int>({ 10, 14, 15 }));
+    assert(right.getAllocator().getPool().liveCount() == 3);
+
+    // Тест: ошибки аргументов
+    bool thrown = false;
+    try {
+        chain.splice(0, other, 1, other.getSize() + 1);
+    }
+    catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    thrown = false;
+    try {
+        chain.splice(0, chain, 0, 1);
+    }
+    catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+}
+
+void testChain2Range() {
+    // Тест: построение из диапазона и дописывание диапазона
+    std::vector<int> values;
+    for (int i = 0; i < 100; ++i) {
+        values.push_back(i * 3);
+    }
+    Chain2<int> chain(values.begin(), values.end());
+    assert(chain.getSize() == 100);
+    assert(chain.toArray() == values);
+    assert(chain.getFirst()->getPrev() == nullptr && chain.getLast()->getNext() == nullptr);
+    chain.seek(57);
+    assert(chain.getCurrent()->getData() == 171);
+    int more[] = { -1, -2, -3 };
+    chain.adder.range(more, more + 3);
+    assert(chain.getSize() == 103 && chain.getLast()->getData() == -3);
+    assert(chain.getLast()->getPrev()->getData() == -2);
+    chain.seek(100);
+    assert(chain.getCurrent()->getData() == -1);
+    chain.adder.range(more, more);
+    assert(chain.getSize() == 103);
+
+    // Тест: однопроходные итераторы дописываются поштучно
+    std::istringstream input("5 6 7");
+    chain.adder.range(std::istream_iterator<int>(input), std::istream_iterator<int>());
+    assert(chain.getSize() == 106 && chain.getLast()->getData() == 7);
+
+    // Тест: копии без удвоения размера
+    Chain2<int> copy(chain);
+    assert(copy.getSize() == chain.getSize());
+    assert(copy.toArray() == chain.toArray());
+    copy.seek(105);
+    assert(copy.getCurrent() == copy.getLast());
+    Chain2<int> assigned;
+    assigned.adder.back(42);
+    assigned = copy;
+    assert(assigned.getSize() == 106 && assigned.toArray() == chain.toArray());
+    assigned = Chain2<int>();
+    assert(assigned.getSize() == 0);
+
+    // Тест: копия и присваивание переносят размер кэша закладок
+    chain.setFingerCache(4);
+    Chain2<int> fingered(chain);
+    assert(fingered.getFingerCache() == 4);
+    Chain2<int> reassigned;
+    reassigned.setFingerCache(8);
+    reassigned = chain;
+    assert(reassigned.getFingerCache() == 4 && reassigned.toArray() == chain.toArray());
+    reassigned.seek(50);
+    assert(reassigned.getCurrent()->getData() == 150);
+    reassigned = Chain2<int>();
+    assert(reassigned.getFingerCache() == 0);
+
+    // Тест: у пула вся серия ложится в один блок
+    PoolLinkAllocator<int> pool(4);
+    Chain2<int, PoolLinkAllocator<int>> pooled(values.begin(), values.end(), pool);
+    assert(pooled.getSize() == 100);
+    assert(pool.getPool().slabCount() == 1 && pool.getPool().liveCount() == 100);
+    Chain2<int, PoolLinkAllocator<int>> pooledCopy(pooled);
+    assert(pool.getPool().slabCount() == 2 && pool.getPool().liveCount() == 200);
+    assert(pooledCopy.toArray() == values);
+}
+
+void testChain2MergeSort() {
+    // Тест: случайные данные с сериями против std::stable_sort, prev-указатели согласованы
+    Chain2<int> chain;
+    std::vector<int> expected;
+    unsigned state = 99;
+    for (int i = 0; i < 5000; ++i) {
+        state = state * 1103515245u + 12345u;
+        int value = (i / 100) % 2 == 0 ? static_cast<int>((state >> 8) % 1000) : 5000 - i; // Случайные куски и убывающие серии
+        chain.adder.back(value);
+        expected.push_back(value);
+    }
+    Link<int>* first = chain.getFirst();
+    int firstValue = first->getData();
+    chain.seek(10);
+    chain.sort();
+    std::stable_sort(expected.begin(), expected.end());
+    assert(chain.toArray() == expected);
+    std::vector<int> backward;
+    for (Link<int>* link = chain.getLast(); link != nullptr; link = link->getPrev()) {
+        backward.push_back(link->getData());
+    }
+    assert(std::equal(backward.rbegin(), backward.rend(), expected.begin()) && backward.size() == expected.size());
+    bool relinked = false; // Звенья те же, перецеплены без копирования
+    for (Link<int>* link = chain.getFirst(); link != nullptr; link = link->getNext()) {
+        relinked = relinked || link == first;
+    }
+    assert(relinked && first->getData() == firstValue);
+    chain.seek(4321);
+    assert(chain.getCurrent()->getData() == expected[4321]);
+
+    // Тест: компаратор и устойчивость
+    Chain2<std::pair<int, int>> pairs;
+    for (int i = 0; i < 300; ++i) {
+        pairs.adder.back(std::make_pair((i * 7) % 10, i));
+    }
+    pairs.sort([](const std::pair<int, int>& a, const std::pair<int, int>& b) { return a.first > b.first; });
+    Link<std::pair<int, int>>* link = pairs.getFirst();
+    for (; link->getNext() != nullptr; link = link->getNext()) {
+        std::pair<int, int> a = link->getData();
+        std::pair<int, int> b = link->getNext()->getData();
+        assert(a.first > b.first || (a.first == b.first && a.second < b.second));
+    }
+    assert(link == pairs.getLast());
+
+    // Тест: уже отсортированный и обратный порядок
+    Chain2<int> sorted;
+    Chain2<int> reversed;
+    for (int i = 0; i < 100; ++i) {
+        sorted.adder.back(i);
+        reversed.adder.front(i);
+    }
+    sorted.sort();
+    reversed.sort(std::greater<int>());
+    assert(sorted.getFirst()->getData() == 0 && sorted.getLast()->getData() == 99);
+    assert(reversed.getFirst()->getData() == 99 && reversed.getLast()->getData() == 0);
+}
+
+void testChain2ParallelSort() {
+    // Тест: части по потокам, устойчивость при равных ключах
+    Chain2<std::pair<int, int>> pairs;
+    std::vector<std::pair<int, int>> expected;
+    unsigned state = 4242;
+    for (int i = 0; i < 5003; ++i) {
+        state = state * 1103515245u + 12345u;
+        std::pair<int, int> value((state >> 8) % 50, i);
+        pairs.adder.back(value);
+        expected.push_back(value);
+    }
+    auto byKey = [](const std::pair<int, int>& a, const std::pair<int, int>& b) { return a.first < b.first; };
+    pairs.parallelSort(5, 100, byKey);
+    std::stable_sort(expected.begin(), expected.end(), byKey);
+    assert(pairs.toArray() == expected);
+    assert(pairs.getSize() == expected.size());
+    assert(pairs.getLast()->getPrev()->getData() == expected[expected.size() - 2]);
+
+    // Тест: параллельная поразрядная сортировка, в том числе на пуле звеньев
+    PoolLinkAllocator<int> pool(64);
+    Chain2<int, PoolLinkAllocator<int>> chain(pool);
+    std::vector<int> values;
+    for (int i = 0; i < 3000; ++i) {
+        state = state * 1103515245u + 12345u;
+        int value = static_cast<int>(state) / 7;
+        chain.adder.back(value);
+        values.push_back(value);
+    }
+    chain.parallelRadixSort(3, 500);
+    std::sort(values.begin(), values.end());
+    assert(chain.toArray() == values);
+    assert(pool.getPool().liveCount() == values.size());
+    chain.seek(2999);
+    assert(chain.getCurrent() == chain.getLast());
+
+    // Тест: параллельная поразрядная сортировка ставит NaN и ±0.0 так же, как radixSort
+    double specials[] = { 5.0, std::nan(""), 1.0, -0.0, 3.0, 0.0, 4.0, -0.0, 0.0, 2.0, -1.5, 6.0 };
+    Chain2<double> serialDoubles;
+    Chain2<double> parallelDoubles;
+    for (int round = 0; round < 40; ++round) {
+        for (double value : specials) {
+            serialDoubles.adder.back(value * (round % 3 == 0 ? 1.0 : -1.0));
+            parallelDoubles.adder.back(value * (round % 3 == 0 ? 1.0 : -1.0));
+        }
+    }
+    serialDoubles.radixSort();
+    parallelDoubles.parallelRadixSort(4, 16);
+    std::vector<double> serialOrder = serialDoubles.toArray();
+    std::vector<double> parallelOrder = parallelDoubles.toArray();
+    assert(serialOrder.size() == parallelOrder.size());
+    assert(std::memcmp(serialOrder.data(), parallelOrder.data(), serialOrder.size() * sizeof(double)) == 0);
+
+    // Тест: исключение сортировки в вызывающем потоке дожидается остальных частей
+    // и возвращает все звенья в цепь
+    Chain2<int> guarded;
+    std::vector<int> guardedValues;
+    for (int i = 0; i < 1000; ++i) {
+        state = state * 1103515245u + 12345u;
+        int value = static_cast<int>((state >> 8) % 10000);
+        guarded.adder.back(value);
+        guardedValues.push_back(value);
+    }
+    std::thread::id caller = std::this_thread::get_id();
+    bool thrown = false;
+    try {
+        guarded.parallelSort(4, 100, [caller](int a, int b) {
+            if (std::this_thread::get_id() == caller) {
+                throw std::runtime_error("Comparison failed!");
+            }
+            return a < b;
+        });
+    }
+    catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    assert(guarded.getSize() == guardedValues.size());
+    size_t backward = 0;
+    for (Link<int>* link = guarded.getLast(); link != nullptr; link = link->getPrev()) {
+        ++backward;
+    }
+    assert(backward == guardedValues.size());
+    std::vector<int> guardedOrder = guarded.toArray();
+    std::sort(guardedOrder.begin(), guardedOrder.end());
+    std::sort(guardedValues.begin(), guardedValues.end());
+    assert(guardedOrder == guardedValues);
+
+    // Тест: короткая цепь сортируется в вызывающем потоке
+    Chain2<int> small;
+    for (int i = 10; i > 0; --i) {
+        small.adder.back(i);
+    }
+    small.parallelSort();
+    assert(small.getFirst()->getData() == 1 && small.getLast()->getData() == 10);
+}
+
+void testUnrolledChain() {
+    // Тест: операции на концах и в середине против эталонного вектора
+    UnrolledChain<int> chain;
+    std::vector<int> expected;
+    unsigned state = 2024;
+    for (int step = 0; step < 3000; ++step) {
+        state = state * 1103515245u + 12345u;
+        size_t position = (state >> 8) % (expected.size() + 1);
+        switch ((state >> 4) % 6) {
+        case 0: chain.adder.front(step); expected.insert(expected.begin(), step); break;
+        case 1: case 2: chain.adder.back(step); expected.push_back(step); break;
+        case 3: chain.adder.at(position, step); expected.insert(expected.begin() + std::min(position, expected.size()), step); break;
+        case 4: if (position < expected.size()) { chain.deleter.at(position); expected.erase(expected.begin() + position); } break;
+        default: if (!expected.empty()) { chain.deleter.front(); expected.erase(expected.begin()); } break;
+        }
+    }
+    assert(chain.getSize() == expected.size());
+    assert(chain.toArray() == expected);
+    assert(chain[expected.size() / 2] == expected[expected.size() / 2]);
+    assert(chain.front() == expected.front() && chain.back() == expected.back());
+    // Блоки заполнены хотя бы на четверть
+    assert(chain.getBlockCount() * UnrolledChain<int>::blockCapacity <= 4 * chain.getSize() + UnrolledChain<int>::blockCapacity);
+
+    // Тест: итератор в обе стороны
+    std::vector<int> walked;
+    for (int value : chain) {
+        walked.push_back(value);
+    }
+    assert(walked == expected);
+    auto it = chain.end();
+    --it;
+    assert(*it == expected.back());
+
+    // Тест: разделение и объединение
+    UnrolledChain<int> second;
+    second.adder.back(-1);
+    chain.divide(37, second);
+    assert(chain.getSize() == 37 && second.getSize() == expected.size() - 37);
+    assert(chain.back() == expected[36] && second.front() == expected[37]);
+    chain.concatenate(second);
+    assert(second.isEmpty() && chain.toArray() == expected);
+
+    // Тест: сортировка, поиск, копирование
+    chain.sort();
+    std::sort(expected.begin(), expected.end());
+    assert(chain.toArray() == expected);
+    assert(chain.search(expected[10]) != nullptr && *chain.search(expected[10]) == expected[10]);
+    assert(chain.search(-5) == nullptr);
+    UnrolledChain<int> copy(chain);
+    while (!chain.isEmpty()) {
+        chain.deleter.back();
+    }
+    assert(chain.getBlockCount() == 0 && copy.toArray() == expected);
+}
+
 void testHIWell() {
     // Создание объекта HIWell
     HIWell<int> well;
@@ -263,6 +836,59 @@ void testRadixSort() {
     assert(unsortedList.getSize() == 8);
     assert(unsortedList.getFirst()->getData() == 2);
     assert(unsortedList.getLast()->getData() == 802);
+
+    // Тест отрицательных чисел и крайних значений
+    Chain2<long long> signedList;
+    std::vector<long long> signedValues = { 5, -3, 0, LLONG_MIN, LLONG_MAX, -1, 1, -1000000000000LL, 42 };
+    for (long long value : signedValues) {
+        signedList.adder.back(value);
+    }
+    signedList.radixSort();
+    std::sort(signedValues.begin(), signedValues.end());
+    assert(signedList.toArray() == signedValues);
+
+    // Тест чисел с плавающей точкой
+    Chain2<double> doubleList;
+    std::vector<double> doubleValues = { 3.5, -2.25, 0.0, -1e300, 1e-300, -0.5, 1e300, 7.0, -7.0, 0.125 };
+    for (double value : doubleValues) {
+        doubleList.adder.back(value);
+    }
+    doubleList.radixSort();
+    std::sort(doubleValues.begin(), doubleValues.end());
+    assert(doubleList.toArray() == doubleValues);
+
+    Chain2<float> floatList;
+    floatList.adder.back(1.5f);
+    floatList.adder.back(-1.5f);
+    floatList.adder.back(-0.25f);
+    floatList.radixSort();
+    assert(floatList.toArray() == std::vector<float>({ -1.5f, -0.25f, 1.5f }));
+
+    // Тест: большой случайный набор, prev-указатели согласованы
+    Chain2<int> randomList;
+    std::vector<int> randomValues;
+    unsigned state = 31337;
+    for (int i = 0; i < 3000; ++i) {
+        state = state * 1103515245u + 12345u;
+        int value = static_cast<int>(state) >> 3;
+        randomList.adder.back(value);
+        randomValues.push_back(value);
+    }
+    randomList.radixSort();
+    std::sort(randomValues.begin(), randomValues.end());
+    assert(randomList.toArray() == randomValues);
+    assert(randomList.getLast()->getData() == randomValues.back());
+    assert(randomList.getLast()->getPrev()->getData() == randomValues[randomValues.size() - 2]);
+    randomList.seek(1500);
+    assert(randomList.getCurrent()->getData() == randomValues[1500]);
+
+    // Тест: младшие байты одинаковы, различаются только старшие
+    Chain2<unsigned> highBytes;
+    for (unsigned i = 0; i < 10; ++i) {
+        highBytes.adder.front(i << 24);
+    }
+    highBytes.radixSort();
+    assert(highBytes.getFirst()->getData() == 0 && highBytes.getLast()->getData() == 9u << 24);
 }
 
 #include <cassert>
@@ -357,6 +983,14 @@ void testIterator() {
 
 int main() {
     testChain2();
+    testChain2Pool();
+    testChain2Index();
+    testChain2Finger();
+    testChain2Splice();
+    testChain2Range();
+    testChain2MergeSort();
+    testChain2ParallelSort();
+    testUnrolledChain();
     testHIWell();
     testQSnake();
     testPostFix();
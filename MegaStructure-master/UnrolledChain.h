@@ -0,0 +1,584 @@
+#pragma once
+#include <algorithm> //  std::sort, std::find, std::move
+#include <iostream>
+#include <stdexcept> //  std::out_of_range
+#include <vector>
+
+/// <summary>
+///     (unrolled linked list):   
+///     BlockBytes  .  
+/// Chain2 (adder, deleter, divide, concatenate, Iterator),  , toArray, search
+///       ,        .
+/// TYPE     
+/// </summary>
+/// <typeparam name="TYPE"></typeparam>
+/// <typeparam name="BlockBytes">       </typeparam>
+template <typename TYPE, size_t BlockBytes = 64>
+class UnrolledChain
+{
+public:
+    /// <summary>
+    ///     (  4)
+    /// </summary>
+    enum : size_t { blockCapacity = BlockBytes / sizeof(TYPE) < 4 ? 4 : BlockBytes / sizeof(TYPE) };
+
+private:
+    /// <summary>
+    /// :  blockCapacity  
+    /// </summary>
+    struct Block {
+        Block* next = nullptr;
+        Block* prev = nullptr;
+        size_t count = 0;
+        TYPE items[blockCapacity];
+    };
+
+    size_t chain_size = 0;
+    size_t block_count = 0;
+    Block* first_block = nullptr;
+    Block* last_block = nullptr;
+
+    /// <summary>
+    ///      (nullptr    )
+    /// </summary>
+    Block* insertBlockAfter(Block* block) {
+        Block* fresh = new Block();
+        fresh->prev = block;
+        fresh->next = block != nullptr ? block->next : first_block;
+        if (fresh->next != nullptr) {
+            fresh->next->prev = fresh;
+        }
+        else {
+            last_block = fresh;
+        }
+        if (block != nullptr) {
+            block->next = fresh;
+        }
+        else {
+            first_block = fresh;
+        }
+        ++block_count;
+        return fresh;
+    }
+
+    /// <summary>
+    ///     (    )
+    /// </summary>
+    void removeBlock(Block* block) {
+        if (block->prev != nullptr) {
+            block->prev->next = block->next;
+        }
+        else {
+            first_block = block->next;
+        }
+        if (block->next != nullptr) {
+            block->next->prev = block->prev;
+        }
+        else {
+            last_block = block->prev;
+        }
+        delete block;
+        --block_count;
+    }
+
+    /// <summary>
+    ///      index; index    .
+    ///     ,    
+    /// </summary>
+    Block* locate(size_t& index) {
+        if (index < chain_size / 2) {
+            Block* block = first_block;
+            while (index >= block->count) {
+                index -= block->count;
+                block = block->next;
+            }
+            return block;
+        }
+        size_t tail = chain_size - index; //      
+        Block* block = last_block;
+        while (tail > block->count) {
+            tail -= block->count;
+            block = block->prev;
+        }
+        index = block->count - tail;
+        return block;
+    }
+
+    /// <summary>
+    ///   [offset, count)       
+    /// </summary>
+    void splitBlock(Block* block, size_t offset) {
+        Block* fresh = insertBlockAfter(block);
+        std::move(block->items + offset, block->items + block->count, fresh->items);
+        fresh->count = block->count - offset;
+        block->count = offset;
+    }
+
+    /// <summary>
+    ///     ;    
+    /// </summary>
+    void insertInto(Block* block, size_t offset, const TYPE& value) {
+        if (block->count == blockCapacity) {
+            splitBlock(block, blockCapacity / 2);
+            if (offset > block->count) {
+                offset -= block->count;
+                block = block->next;
+            }
+        }
+        std::move_backward(block->items + offset, block->items + block->count, block->items + block->count + 1);
+        block->items[offset] = value;
+        ++block->count;
+        ++chain_size;
+    }
+
+    /// <summary>
+    ///     .   ,  ,
+    ///    ,   ,   
+    /// </summary>
+    void eraseFrom(Block* block, size_t offset) {
+        std::move(block->items + offset + 1, block->items + block->count, block->items + offset);
+        --block->count;
+        block->items[block->count] = TYPE();
+        --chain_size;
+        if (block->count == 0) {
+            removeBlock(block);
+            return;
+        }
+        Block* next = block->next;
+        if (block->count < blockCapacity / 2 && next != nullptr && block->count + next->count <= blockCapacity) {
+            std::move(next->items, next->items + next->count, block->items + block->count);
+            block->count += next->count;
+            removeBlock(next);
+        }
+    }
+
+    /// <summary>
+    ///   other   () 
+    /// </summary>
+    void copyFrom(const UnrolledChain& other) {
+        for (Block* block = other.first_block; block != nullptr; block = block->next) {
+            Block* copy = insertBlockAfter(last_block);
+            std::copy(block->items, block->items + block->count, copy->items);
+            copy->count = block->count;
+        }
+        chain_size = other.chain_size;
+    }
+
+    /// <summary>
+    ///  
+    /// </summary>
+    class NodeAdder {
+    private:
+        UnrolledChain* chain;
+
+    public:
+        NodeAdder(UnrolledChain* chain) : chain(chain) {}
+
+        /// <summary>
+        ///   
+        /// </summary>
+        /// <param name="value">  </param>
+        void front(TYPE value) {
+            Block* block = chain->first_block;
+            if (block == nullptr || block->count == blockCapacity) {
+                block = chain->insertBlockAfter(nullptr);
+            }
+            chain->insertInto(block, 0, value);
+        }
+
+        /// <summary>
+        ///   
+        /// </summary>
+        /// <param name="value">  </param>
+        void back(TYPE value) {
+            Block* block = chain->last_block;
+            if (block == nullptr || block->count == blockCapacity) {
+                block = chain->insertBlockAfter(block);
+            }
+            block->items[block->count++] = value;
+            ++chain->chain_size;
+        }
+
+        /// <summary>
+        ///      
+        /// </summary>
+        /// <param name="index">  </param>
+        /// <param name="value">  </param>
+        void at(size_t index, TYPE value) {
+            if (index == 0) {
+                front(value);
+                return;
+            }
+            if (index >= chain->chain_size) {
+                back(value);
+                return;
+            }
+            Block* block = chain->locate(index);
+            chain->insertInto(block, index, value);
+        }
+    };
+
+    /// <summary>
+    ///  
+    /// </summary>
+    class NodeDeleter {
+    private:
+        UnrolledChain* chain;
+
+    public:
+        NodeDeleter(UnrolledChain* chain) : chain(chain) {}
+
+        /// <summary>
+        ///  
+        /// </summary>
+        void front() {
+            if (chain->chain_size != 0) {
+                chain->eraseFrom(chain->first_block, 0);
+            }
+        }
+
+        /// <summary>
+        ///  
+        /// </summary>
+        void back() {
+            if (chain->chain_size != 0) {
+                chain->eraseFrom(chain->last_block, chain->last_block->count - 1);
+            }
+        }
+
+        /// <summary>
+        ///   
+        /// </summary>
+        /// <param name="index">  </param>
+        void at(size_t index) {
+            if (index >= chain->chain_size) {
+                return;
+            }
+            Block* block = chain->locate(index);
+            chain->eraseFrom(block, index);
+        }
+    };
+
+public:
+    /// <summary>
+    ///   
+    /// </summary>
+    UnrolledChain() {}
+
+    /// <summary>
+    ///     
+    /// </summary>
+    /// <param name="value">  </param>
+    UnrolledChain(TYPE value) {
+        adder.back(value);
+    }
+
+    /// <summary>
+    ///  
+    /// </summary>
+    NodeAdder adder{ this };
+
+    /// <summary>
+    ///  
+    /// </summary>
+    NodeDeleter deleter{ this };
+
+    /// <summary>
+    /// 
+    /// </summary>
+    ~UnrolledChain() {
+        clear();
+    }
+
+    /// <summary>
+    ///  :   
+    /// </summary>
+    /// <param name="other"></param>
+    UnrolledChain(const UnrolledChain& other) {
+        copyFrom(other);
+    }
+
+    /// <summary>
+    ///  
+    /// </summary>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    UnrolledChain& operator=(const UnrolledChain& other) {
+        if (this != &other) {
+            clear();
+            copyFrom(other);
+        }
+        return *this;
+    }
+
+    /// <summary>
+    ///  
+    /// </summary>
+    /// <param name="other"></param>
+    UnrolledChain(UnrolledChain&& other) noexcept
+        : chain_size(other.chain_size), block_count(other.block_count), first_block(other.first_block), last_block(other.last_block) {
+        other.chain_size = 0;
+        other.block_count = 0;
+        other.first_block = nullptr;
+        other.last_block = nullptr;
+    }
+
+    /// <summary>
+    ///  
+    /// </summary>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    UnrolledChain& operator=(UnrolledChain&& other) noexcept {
+        if (this != &other) {
+            clear();
+            chain_size = other.chain_size;
+            block_count = other.block_count;
+            first_block = other.first_block;
+            last_block = other.last_block;
+
+            other.chain_size = 0;
+            other.block_count = 0;
+            other.first_block = nullptr;
+            other.last_block = nullptr;
+        }
+        return *this;
+    }
+
+    /// <summary>
+    ///   
+    /// </summary>
+    /// <returns>  </returns>
+    size_t getSize() const { return chain_size; }
+
+    /// <summary>
+    ///   (  )
+    /// </summary>
+    size_t getBlockCount() const { return block_count; }
+
+    bool isEmpty() const { return chain_size == 0; }
+
+    /// <summary>
+    ///  
+    /// </summary>
+    TYPE& front() { return first_block->items[0]; }
+
+    /// <summary>
+    ///  
+    /// </summary>
+    TYPE& back() { return last_block->items[last_block->count - 1]; }
+
+    /// <summary>
+    ///   :     
+    /// </summary>
+    /// <param name="index">  </param>
+    /// <returns>    </returns>
+    TYPE& operator[](size_t index) {
+        if (index >= chain_size) {
+            throw std::out_of_range("UnrolledChain index out of range!");
+        }
+        Block* block = locate(index);
+        return block->items[index];
+    }
+
+    /// <summary>
+    ///   :   
+    /// </summary>
+    /// <returns></returns>
+    std::vector<TYPE> toArray() const {
+        std::vector<TYPE> array;
+        array.reserve(chain_size);
+        for (Block* block = first_block; block != nullptr; block = block->next) {
+            array.insert(array.end(), block->items, block->items + block->count);
+        }
+        return array;
+    }
+
+    /// <summary>
+    ///    
+    /// </summary>
+    /// <param name="value">   </param>
+    /// <returns>     (nullptr,   ) </returns>
+    TYPE* search(const TYPE& value) {
+        for (Block* block = first_block; block != nullptr; block = block->next) {
+            TYPE* end = block->items + block->count;
+            TYPE* found = std::find(block->items, end, value);
+            if (found != end) {
+                return found;
+            }
+        }
+        return nullptr;
+    }
+
+    /// <summary>
+    ///  :     ,
+    ///        
+    /// </summary>
+    void sort() {
+        if (chain_size <= 1) {
+            return;
+        }
+        std::vector<TYPE> buffer = toArray();
+        std::sort(buffer.begin(), buffer.end());
+        auto source = buffer.begin();
+        for (Block* block = first_block; block != nullptr; block = block->next) {
+            std::move(source, source + block->count, block->items);
+            source += block->count;
+        }
+    }
+
+    /// <summary>
+    ///  :  other   O(1)
+    /// </summary>
+    /// <param name="other">   </param>
+    void concatenate(UnrolledChain& other) {
+        if (other.chain_size == 0 || &other == this) {
+            return;
+        }
+        if (chain_size == 0) {
+            first_block = other.first_block;
+        }
+        else {
+            last_block->next = other.first_block;
+            other.first_block->prev = last_block;
+        }
+        last_block = other.last_block;
+        chain_size += other.chain_size;
+        block_count += other.block_count;
+
+        other.chain_size = 0;
+        other.block_count = 0;
+        other.first_block = nullptr;
+        other.last_block = nullptr;
+    }
+
+    /// <summary>
+    ///      :     index ,
+    ///    secondList (   )
+    /// </summary>
+    /// <param name="index">   </param>
+    /// <param name="secondList"> ,     </param>
+    void divide(size_t index, UnrolledChain& secondList) {
+        if (index >= chain_size || &secondList == this) {
+            return;
+        }
+        secondList.clear();
+        size_t offset = index;
+        Block* block = locate(offset);
+        if (offset != 0) {
+            splitBlock(block, offset);
+            block = block->next;
+        }
+
+        size_t moved = 0;
+        for (Block* ptr = block; ptr != nullptr; ptr = ptr->next) {
+            ++moved;
+        }
+        secondList.first_block = block;
+        secondList.last_block = last_block;
+        secondList.chain_size = chain_size - index;
+        secondList.block_count = moved;
+
+        last_block = block->prev;
+        if (last_block != nullptr) {
+            last_block->next = nullptr;
+        }
+        else {
+            first_block = nullptr;
+        }
+        block->prev = nullptr;
+        chain_size = index;
+        block_count -= moved;
+    }
+
+    /// <summary>
+    ///  
+    /// </summary>
+    void clear() {
+        Block* block = first_block;
+        while (block != nullptr) {
+            Block* next = block->next;
+            delete block;
+            block = next;
+        }
+        first_block = nullptr;
+        last_block = nullptr;
+        chain_size = 0;
+        block_count = 0;
+    }
+
+    /// <summary>
+    ///    cout
+    /// </summary>
+    /// <param name="os"></param>
+    /// <param name="chain"></param>
+    /// <returns></returns>
+    friend std::ostream& operator<<(std::ostream& os, const UnrolledChain& chain) {
+        bool first = true;
+        for (Block* block = chain.first_block; block != nullptr; block = block->next) {
+            for (size_t i = 0; i < block->count; ++i) {
+                if (!first) {
+                    os << ", ";
+                }
+                os << block->items[i];
+                first = false;
+            }
+        }
+        return os;
+    }
+
+public:
+    // 
+    class Iterator {
+    private:
+        Block* block;
+        size_t offset;
+        UnrolledChain* chain; //     end()   
+
+    public:
+        Iterator(Block* block, size_t offset, UnrolledChain* chain) : block(block), offset(offset), chain(chain) {}
+
+        Iterator& operator++() {
+            if (block && ++offset == block->count) {
+                block = block->next;
+                offset = 0;
+            }
+            return *this;
+        }
+
+        ///  end()    ,      
+        Iterator& operator--() {
+            if (block == nullptr) {
+                block = chain->last_block;
+                offset = block != nullptr ? block->count - 1 : 0;
+            }
+            else if (offset > 0) {
+                --offset;
+            }
+            else if (block->prev != nullptr) {
+                block = block->prev;
+                offset = block->count - 1;
+            }
+            return *this;
+        }
+
+        TYPE& operator*() const {
+            return block->items[offset];
+        }
+
+        bool operator!=(const Iterator& other) const {
+            return block != other.block || offset != other.offset;
+        }
+
+        bool operator==(const Iterator& other) const {
+            return block == other.block && offset == other.offset;
+        }
+    };
+
+    Iterator begin() {
+        return Iterator(first_block, 0, this);
+    }
+
+    Iterator end() {
+        return Iterator(nullptr, 0, this);
+    }
+};